@@ -0,0 +1,185 @@
+#ifndef LIBMESH_BENCHMARK_H
+#define LIBMESH_BENCHMARK_H
+
+#include <libmesh/libmesh.h>
+#include <libmesh/enum_elem_type.h>
+#include <libmesh/parallel.h>
+
+// C++ includes
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace libMesh
+{
+
+// Forward declarations
+class UnstructuredMesh;
+
+namespace Benchmarks
+{
+
+/**
+ * A single timed operation.  setup() is called once, untimed, before
+ * any iterations; each call to run() performs one iteration of the
+ * timed operation and returns the number of "items" (elements,
+ * points, dofs...) it processed, so throughput can be reported too.
+ *
+ * Every processor runs the same number of iterations, so run() may
+ * be collective.
+ */
+class Benchmark
+{
+public:
+  Benchmark (std::string name) : _name(std::move(name)) {}
+
+  virtual ~Benchmark () = default;
+
+  const std::string & name () const { return _name; }
+
+  virtual void setup () {}
+
+  virtual std::size_t run () = 0;
+
+  virtual void teardown () {}
+
+private:
+  const std::string _name;
+};
+
+
+/**
+ * Problem size settings shared by every benchmark.
+ */
+struct BenchmarkOptions
+{
+  // Elements per side of generated meshes
+  unsigned int n_elem;
+
+  // If true, n_elem is scaled so that the number of elements per
+  // processor, rather than the total, stays fixed as processors are
+  // added.
+  bool weak_scaling = false;
+};
+
+
+/**
+ * Time spent in one PerfLog event during the timed iterations of a
+ * benchmark, excluding sub-events, on processor 0.
+ */
+struct PerfLogResult
+{
+  std::string header;
+  std::string label;
+  unsigned long long count;
+  double seconds;
+};
+
+
+/**
+ * Timing of one benchmark, summed over all iterations.  Times are
+ * wall clock and process CPU seconds, maximized over processors.
+ *
+ * \p max_rss is the peak resident set size of any processor by the
+ * end of the benchmark, in bytes, or 0 if we can't tell.  It never
+ * decreases from one benchmark to the next, so it is most telling
+ * when a single benchmark is run.
+ */
+struct BenchmarkResult
+{
+  std::string name;
+  unsigned long long iterations;
+  double seconds;
+  double cpu_seconds;
+  std::size_t items_per_iteration;
+  std::size_t max_rss;
+  std::vector<PerfLogResult> perf_log;
+};
+
+
+/**
+ * Runs each registered benchmark for enough iterations to take at
+ * least \p min_time seconds, and writes results as JSON (in the
+ * layout Google Benchmark uses, so the same comparison scripts work)
+ * or CSV.
+ */
+class BenchmarkRunner
+{
+public:
+  BenchmarkRunner (const Parallel::Communicator & comm,
+                   double min_time);
+
+  void add (std::unique_ptr<Benchmark> benchmark);
+
+  /**
+   * Runs every benchmark whose name contains \p filter.
+   */
+  void run (const std::string & filter = "");
+
+  /**
+   * Writes the results, and \p options in the context section, as
+   * JSON.
+   */
+  void write_json (std::ostream & os,
+                   const BenchmarkOptions & options) const;
+
+  void write_csv (std::ostream & os) const;
+
+  const std::vector<BenchmarkResult> & results () const { return _results; }
+
+private:
+  BenchmarkResult run_one (Benchmark & benchmark);
+
+  const Parallel::Communicator & _comm;
+
+  const double _min_time;
+
+  std::vector<std::unique_ptr<Benchmark>> _benchmarks;
+
+  std::vector<BenchmarkResult> _results;
+};
+
+
+/**
+ * Builds a unit line, square or cube of \p type elements (of whatever
+ * dimension \p type is), with \p options.n_elem elements per side,
+ * times the dim'th root of the number of processors if
+ * \p options.weak_scaling.
+ */
+void build_benchmark_mesh (UnstructuredMesh & mesh,
+                           const BenchmarkOptions & options,
+                           ElemType type);
+
+/**
+ * The element type benchmarks use when they don't loop over types:
+ * second order, of the highest dimension we're built for.
+ */
+ElemType default_benchmark_elem_type ();
+
+
+// Each benchmark source adds its benchmarks to the runner
+void add_fe_benchmarks (BenchmarkRunner & runner,
+                        const Parallel::Communicator & comm,
+                        const BenchmarkOptions & options);
+
+void add_dof_map_benchmarks (BenchmarkRunner & runner,
+                             const Parallel::Communicator & comm,
+                             const BenchmarkOptions & options);
+
+void add_mesh_benchmarks (BenchmarkRunner & runner,
+                          const Parallel::Communicator & comm,
+                          const BenchmarkOptions & options);
+
+void add_system_benchmarks (BenchmarkRunner & runner,
+                            const Parallel::Communicator & comm,
+                            const BenchmarkOptions & options);
+
+void add_scaling_benchmarks (BenchmarkRunner & runner,
+                             const Parallel::Communicator & comm,
+                             const BenchmarkOptions & options);
+
+} // namespace Benchmarks
+} // namespace libMesh
+
+#endif // LIBMESH_BENCHMARK_H
@@ -0,0 +1,70 @@
+#!/usr/bin/env python3
+"""Compares two libMesh benchmark result files.
+
+Usage: compare_benchmarks.py [--threshold T] baseline.json new.json
+
+Prints the ratio of new to baseline real time and peak memory for each
+benchmark in both files, and exits with status 1 if any benchmark got
+slower by more than the fractional threshold T (default 0.1).
+"""
+
+import argparse
+import json
+import sys
+
+
+def load(filename):
+    with open(filename) as f:
+        data = json.load(f)
+    return data.get('context', {}), {b['name']: b for b in data['benchmarks']}
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('--threshold', type=float, default=0.1)
+    parser.add_argument('baseline')
+    parser.add_argument('new')
+    args = parser.parse_args()
+
+    old_context, old = load(args.baseline)
+    new_context, new = load(args.new)
+
+    for key in ('n_processors', 'n_threads', 'n_elem', 'weak_scaling'):
+        if old_context.get(key) != new_context.get(key):
+            print('Warning: %s differs: %s in baseline, %s now' %
+                  (key, old_context.get(key), new_context.get(key)))
+
+    print('%-56s %14s %14s %8s %8s' %
+          ('Benchmark', 'Baseline (ns)', 'New (ns)', 'Time', 'Memory'))
+
+    regressions = []
+    for name, result in new.items():
+        if name not in old:
+            print('%-56s %14s %14.0f' % (name, '-', result['real_time']))
+            continue
+
+        base = old[name]
+        time_ratio = result['real_time'] / base['real_time'] \
+            if base['real_time'] > 0 else float('inf')
+
+        old_rss, new_rss = base.get('max_rss', 0), result.get('max_rss', 0)
+        rss = '%8.3f' % (new_rss / old_rss) if old_rss and new_rss else '%8s' % '-'
+
+        print('%-56s %14.0f %14.0f %8.3f %s' %
+              (name, base['real_time'], result['real_time'], time_ratio, rss))
+
+        if time_ratio > 1 + args.threshold:
+            regressions.append(name)
+
+    if regressions:
+        print('\n%d benchmark(s) slower than baseline by more than %g%%:' %
+              (len(regressions), 100 * args.threshold))
+        for name in regressions:
+            print('  ' + name)
+        return 1
+
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -48,6 +48,7 @@ enum Order : int;
 #include <iterator>
 #include <map>
 #include <string>
+#include <unordered_map>
 #include <vector>
 #include <memory>
 
@@ -63,6 +64,7 @@ class DofMap;
 class DofObject;
 class Elem;
 class FEType;
+class MemoryUsage;
 class MeshBase;
 class PeriodicBoundaryBase;
 class PeriodicBoundaries;
@@ -254,11 +256,65 @@ public:
    */
   bool computed_sparsity_already () const;
 
+  /**
+   * \returns \p true if the most recent \p compute_sparsity() found,
+   * on every processor, the same sparsity pattern and nonzero counts
+   * as the \p compute_sparsity() before it, so that matrices
+   * preallocated for the previous pattern can be reused as they are.
+   *
+   * Patterns are compared by hashes of their coupled dof blocks and
+   * nonzero counts.  Patterns modified by an extra sparsity function
+   * or object are never considered unchanged, since those
+   * modifications are not hashed.
+   */
+  bool sparsity_pattern_unchanged () const
+  { return _sparsity_pattern_unchanged; }
+
   /**
    * Clears the sparsity pattern
    */
   void clear_sparsity();
 
+  /**
+   * Saves the current send list and constraint rows, for a later
+   * check_dof_state_unchanged() to compare against.
+   */
+  void save_dof_state ();
+
+  /**
+   * Checks whether, on every processor, the most recent
+   * distribute_dofs() gave every degree of freedom the same index it
+   * had before, and the send list and constraints now match those
+   * saved by the last save_dof_state().  Vectors, sparsity patterns
+   * and matrices built for the old numbering are then still valid,
+   * e.g. for a system whose variables live only on subdomains which
+   * a mesh refinement did not touch.  Releases the saved state.
+   *
+   * Old dof indices are only recorded with AMR enabled; otherwise
+   * the check always fails.
+   *
+   * \returns The result, which dof_state_unchanged() also returns
+   * until the next distribute_dofs().
+   */
+  bool check_dof_state_unchanged (const MeshBase & mesh);
+
+  /**
+   * \returns The result of check_dof_state_unchanged() since the
+   * last distribute_dofs(), or \p false if it has not been called.
+   */
+  bool dof_state_unchanged () const
+  { return _dof_state_unchanged; }
+
+  /**
+   * \returns A number which changes whenever clear(),
+   * distribute_dofs() or process_constraints() may have changed the
+   * DoF numbering, the elements it was computed on, or the
+   * constraints.  Caches of per-element data can compare it against
+   * the value they were built with to tell whether they are stale.
+   */
+  unsigned long dof_serial_number () const
+  { return _dof_serial_number; }
+
   /**
    * Remove any default ghosting functor(s).  User-added ghosting
    * functors will be unaffected.
@@ -636,6 +692,18 @@ public:
     return (this->has_blocked_representation() ? this->n_variables() : 1);
   }
 
+  /**
+   * Checks whether \p di, ordered variable by variable as filled by
+   * dof_indices(elem, di), consists of whole blocks of block_size()
+   * consecutive dofs, with the same number of dofs for each variable.
+   *
+   * \returns \p true, and fills \p block_indices with the index of
+   * each block, if so; in that case row \p v*block_indices.size()+b
+   * of an element matrix is dof \p v of block \p b.
+   */
+  bool blocked_dof_indices (const std::vector<dof_id_type> & di,
+                            std::vector<dof_id_type> & block_indices) const;
+
   /**
    * \returns The total number of degrees of freedom in the problem.
    */
@@ -807,6 +875,17 @@ public:
    */
   bool all_semilocal_indices (const std::vector<dof_id_type> & dof_indices) const;
 
+  /**
+   * Sorts the active local elements of \p mesh into \p interior,
+   * the elements whose degrees of freedom are all local and
+   * unconstrained, and \p boundary, all the others.  An interior
+   * element can be evaluated from the locally owned entries of a
+   * vector alone, and its contributions only reach local rows.
+   */
+  void partition_interior_elements (const MeshBase & mesh,
+                                    std::vector<const Elem *> & interior,
+                                    std::vector<const Elem *> & boundary) const;
+
   /**
    * \returns \p true if degree of freedom index \p dof_index
    * is a local index.
@@ -862,6 +941,56 @@ public:
                               const MeshBase & mesh,
                               unsigned int var_num) const;
 
+  /**
+   * \returns The dof indices which belong to the given variable number
+   * and live on the current processor, as \p local_variable_indices()
+   * would fill them.  The indices of each variable are
+   * computed on the first call after each \p distribute_dofs() and
+   * kept until the next one, so that e.g. fieldsplit preconditioners
+   * set up for every solve don't scan the mesh every time.
+   */
+  const std::vector<dof_id_type> &
+  cached_local_variable_indices(const MeshBase & mesh,
+                                unsigned int var_num) const;
+
+  /**
+   * Enables or disables caching of the dof indices of each active
+   * local element.  When enabled, the cache is rebuilt (in parallel,
+   * if threads are available) at the end of every \p distribute_dofs(),
+   * and \p dof_indices() calls for local elements at their own p level
+   * are answered by copying from the cache, without walking element
+   * and node DofObjects.
+   *
+   * This trades memory for speed in codes which call \p dof_indices()
+   * on the same elements many times between reinits, e.g. in repeated
+   * residual evaluations.  Caching is disabled by default.
+   */
+  void cache_dof_indices (bool cache);
+
+  /**
+   * \returns \p true if dof indices are being cached.
+   */
+  bool caching_dof_indices () const { return _cache_dof_indices; }
+
+  /**
+   * Enables or disables a reverse Cuthill-McKee reordering of the dofs
+   * within each processor's local block, computed from the graph of
+   * DofObjects coupled through active local elements.  This reduces
+   * the bandwidth of the system matrix, and so the fill-in and memory
+   * use of direct factorizations.  The dofs on each node or element
+   * stay contiguous, as with \p --node-major-dofs.
+   *
+   * The reordering takes effect at the next \p distribute_dofs(); it
+   * can also be enabled for every system with the \p --rcm-dofs
+   * command line option.  It is disabled by default.
+   */
+  void use_rcm_dof_ordering (bool rcm);
+
+  /**
+   * \returns \p true if local dofs are reordered to reduce bandwidth.
+   */
+  bool using_rcm_dof_ordering () const;
+
 #ifdef LIBMESH_ENABLE_CONSTRAINTS
 
   //--------------------------------------------------------------------
@@ -878,6 +1007,26 @@ public:
    */
   dof_id_type n_local_constrained_dofs() const;
 
+  /**
+   * Enables or disables caching of element constraint matrices.  When
+   * enabled, the constraint matrix \p C built for each distinct set of
+   * element dof indices (e.g. each element on a mesh with hanging
+   * nodes or periodic boundaries) is saved the first time it is
+   * needed, and reused by every later \p constrain_element_*() call
+   * on the same dofs, so that repeated assemblies don't repeat the
+   * constraint expansion element by element.
+   *
+   * The cache is emptied whenever constraints are recomputed or
+   * modified.  Caching is disabled by default.
+   */
+  void cache_constraint_matrices (bool cache);
+
+  /**
+   * \returns \p true if element constraint matrices are being cached.
+   */
+  bool caching_constraint_matrices () const
+  { return _cache_constraint_matrices; }
+
 #ifdef LIBMESH_ENABLE_NODE_CONSTRAINTS
   /**
    * \returns The total number of constrained Nodes
@@ -894,6 +1043,21 @@ public:
    */
   void create_dof_constraints (const MeshBase &, Real time=0);
 
+  /**
+   * Rebuilds the raw degree of freedom constraints like
+   * create_dof_constraints(), but reuses the hanging node and
+   * periodic constraints saved by its last call, recomputing only
+   * Dirichlet constraints at the given \p time.  This is much
+   * cheaper when only time-dependent Dirichlet boundary functions
+   * have changed.
+   *
+   * Falls back on create_dof_constraints() if nothing has been saved
+   * since dofs were last distributed or periodic boundaries were
+   * last added.  Users who modify periodic boundaries in place must
+   * call create_dof_constraints() instead.
+   */
+  void update_dirichlet_constraints (const MeshBase &, Real time=0);
+
   /**
    * Gathers constraint equation dependencies from other processors
    */
@@ -998,12 +1162,14 @@ public:
   {
     libmesh_assert(_stashed_dof_constraints.empty());
     _dof_constraints.swap(_stashed_dof_constraints);
+    this->clear_constraint_matrix_cache();
   }
 
   void unstash_dof_constraints()
   {
     libmesh_assert(_dof_constraints.empty());
     _dof_constraints.swap(_stashed_dof_constraints);
+    this->clear_constraint_matrix_cache();
   }
 
   /**
@@ -1021,6 +1187,7 @@ public:
   void swap_dof_constraints()
   {
     _dof_constraints.swap(_stashed_dof_constraints);
+    this->clear_constraint_matrix_cache();
   }
 
 #ifdef LIBMESH_ENABLE_NODE_CONSTRAINTS
@@ -1433,6 +1600,13 @@ public:
    */
   std::string get_info() const;
 
+  /**
+   * \returns The memory held on this processor by the send list,
+   * the dof partitioning, the constraints, the sparsity pattern (if
+   * it has been kept) and the dof indices cache.
+   */
+  MemoryUsage memory_usage() const;
+
   /**
    * Degree of freedom coupling.  If left empty each DOF
    * couples to all others.  Can be used to reduce memory
@@ -1549,6 +1723,16 @@ private:
   void distribute_local_dofs_node_major (dof_id_type & next_free_dof,
                                          MeshBase & mesh);
 
+  /**
+   * Renumbers the \p n_object_dofs local dofs on nodes and elements,
+   * which must currently be numbered from zero, in reverse
+   * Cuthill-McKee order of the graph of DofObjects coupled through
+   * active local elements.  The dofs on each DofObject remain
+   * contiguous.
+   */
+  void reorder_local_dofs_rcm (dof_id_type n_object_dofs,
+                               MeshBase & mesh);
+
   /*
    * A utility method for obtaining a set of elements to ghost along
    * with merged coupling matrices.
@@ -1568,6 +1752,41 @@ private:
    */
   void add_neighbors_to_send_list(MeshBase & mesh);
 
+  /**
+   * Fills the dof indices cache for every active local element of
+   * \p mesh, if caching is enabled.
+   */
+  void build_dof_indices_cache (const MeshBase & mesh);
+
+  /**
+   * Empties the dof indices cache.
+   */
+  void clear_dof_indices_cache ();
+
+  /**
+   * Empties the cache used by \p cached_local_variable_indices().
+   */
+  void clear_local_variable_indices_cache ();
+
+  /**
+   * Sets \p di to the cached dof indices of \p elem for variable
+   * \p vn, or for all variables if \p vn is \p invalid_uint.
+   *
+   * \returns \p false, with \p di untouched, if \p elem is not in
+   * the cache.
+   */
+  bool cached_dof_indices (const Elem * const elem,
+                           std::vector<dof_id_type> & di,
+                           const unsigned int vn = libMesh::invalid_uint) const;
+
+#ifdef LIBMESH_ENABLE_DIRICHLET
+  /**
+   * Adds primal and adjoint Dirichlet constraints at the given
+   * \p time, from the active local elements with boundary ids.
+   */
+  void create_dirichlet_constraints (const MeshBase & mesh, Real time);
+#endif
+
 #ifdef LIBMESH_ENABLE_CONSTRAINTS
 
   /**
@@ -1584,6 +1803,27 @@ private:
                                 std::vector<dof_id_type> & elem_dofs,
                                 const bool called_recursively=false) const;
 
+  /**
+   * If a constraint matrix for \p elem_dofs has been cached, sets
+   * \p C to it, appends the dofs it depends on to \p elem_dofs, and
+   * returns \p true.
+   */
+  bool cached_constraint_matrix (DenseMatrix<Number> & C,
+                                 std::vector<dof_id_type> & elem_dofs) const;
+
+  /**
+   * Caches the constraint matrix \p C built for the first
+   * \p n_orig_dofs entries of \p elem_dofs.
+   */
+  void cache_constraint_matrix (const DenseMatrix<Number> & C,
+                                const std::vector<dof_id_type> & elem_dofs,
+                                unsigned int n_orig_dofs) const;
+
+  /**
+   * Empties the constraint matrix cache.
+   */
+  void clear_constraint_matrix_cache ();
+
   /**
    * Build the constraint matrix C and the forcing vector H
    * associated with the element degree of freedom indices elem_dofs.
@@ -1633,6 +1873,23 @@ private:
    */
   bool _error_on_constraint_loop;
 
+#ifdef LIBMESH_ENABLE_CONSTRAINTS
+  /**
+   * Default false; set to true to cache element constraint matrices.
+   */
+  bool _cache_constraint_matrices;
+
+  /**
+   * Cached element constraint matrices, keyed by the element dof
+   * indices they were built for.  Each entry holds the additional
+   * dofs the constrained dofs depend on, and the values of \p C with
+   * one row per key dof and one column per key or additional dof.
+   */
+  mutable std::map<std::vector<dof_id_type>,
+                   std::pair<std::vector<dof_id_type>, std::vector<Number>>>
+  _constraint_matrix_cache;
+#endif
+
   /**
    * The finite element type for each variable.
    */
@@ -1770,6 +2027,88 @@ private:
    */
   bool need_full_sparsity_pattern;
 
+  /**
+   * Hashes of the most recently computed sparsity pattern and its
+   * nonzero counts, or empty if there's none to compare against.
+   */
+  std::vector<dof_id_type> _sparsity_hashes;
+
+  /**
+   * Whether the most recently computed sparsity pattern matched
+   * the one before it.
+   */
+  bool _sparsity_pattern_unchanged;
+
+  /**
+   * Whether save_dof_state() has saved a send list and constraints
+   * which check_dof_state_unchanged() has not yet compared against.
+   */
+  bool _have_saved_dof_state;
+
+  /**
+   * The result of check_dof_state_unchanged().
+   */
+  bool _dof_state_unchanged;
+
+  /**
+   * Incremented by every change which may invalidate per-element
+   * caches; see dof_serial_number().
+   */
+  unsigned long _dof_serial_number;
+
+  /**
+   * The send list and constraints saved by save_dof_state().
+   */
+  std::vector<dof_id_type> _saved_send_list;
+#ifdef LIBMESH_ENABLE_CONSTRAINTS
+  DofConstraints _saved_dof_constraints;
+  DofConstraintValueMap _saved_primal_constraint_values;
+  AdjointDofConstraintValues _saved_adjoint_constraint_values;
+#endif
+
+  /**
+   * Default false; set to true to reorder local dofs by reverse
+   * Cuthill-McKee.
+   */
+  bool _rcm_dof_ordering;
+
+  /**
+   * Default false; set to true to cache the dof indices of active
+   * local elements.
+   */
+  bool _cache_dof_indices;
+
+  /**
+   * The cached dof indices of every active local element, packed
+   * together.
+   */
+  std::vector<dof_id_type> _dof_indices_cache;
+
+  /**
+   * For each cached element, the n_variables()+1 offsets into
+   * \p _dof_indices_cache at which each of its variables' indices
+   * begin, followed by the end of its last variable's indices.
+   */
+  std::vector<std::size_t> _dof_indices_cache_var_offsets;
+
+  /**
+   * The id of each cached element, to guard against stale pointers.
+   */
+  std::vector<dof_id_type> _dof_indices_cache_ids;
+
+  /**
+   * The cache slot of each cached element.
+   */
+  std::unordered_map<const Elem *, std::size_t> _dof_indices_cache_slots;
+
+  /**
+   * The local dof indices of each variable, for those variables
+   * \p cached_local_variable_indices() has been called for since the
+   * last \p distribute_dofs().
+   */
+  mutable std::map<unsigned int, std::vector<dof_id_type>>
+  _local_variable_indices_cache;
+
   /**
    * The sparsity pattern of the global matrix.  If
    * need_full_sparsity_pattern is true, we save the entire sparse
@@ -1823,6 +2162,19 @@ private:
   DofConstraintValueMap      _primal_constraint_values;
 
   AdjointDofConstraintValues _adjoint_constraint_values;
+
+  /**
+   * The hanging node and periodic constraint rows from the last
+   * create_dof_constraints() call, before any Dirichlet or user
+   * constraints were added or the rows were processed, for reuse by
+   * update_dirichlet_constraints().
+   */
+  DofConstraints _geometric_dof_constraints;
+
+  /**
+   * Whether \p _geometric_dof_constraints is up to date.
+   */
+  bool _geometric_dof_constraints_valid;
 #endif
 
 #ifdef LIBMESH_ENABLE_NODE_CONSTRAINTS
@@ -1853,6 +2205,22 @@ private:
    * entry is the constraint matrix row for boundaryid i.
    */
   std::vector<DirichletBoundaries *> _adjoint_dirichlet_boundaries;
+
+  /**
+   * The active local elements with boundary ids on any of their
+   * sides, edges, shellfaces or nodes, found by
+   * create_dof_constraints() and reused until dofs are next
+   * distributed, so Dirichlet constraints need not rescan every
+   * element.
+   */
+  std::vector<const Elem *> _boundary_elem_cache;
+
+  /**
+   * The numbers of side, edge, shellface and node boundary
+   * conditions when \p _boundary_elem_cache was built, to notice
+   * boundary ids added or removed since; empty if there is no cache.
+   */
+  std::vector<std::size_t> _boundary_elem_cache_key;
 #endif
 
   friend class SparsityPattern::Build;
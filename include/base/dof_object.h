@@ -27,6 +27,7 @@
 #include "libmesh/libmesh_common.h"
 #include "libmesh/libmesh.h" // libMesh::invalid_uint
 #include "libmesh/reference_counted_object.h"
+#include "libmesh/small_vector.h"
 
 // C++ includes
 #include <cstddef>
@@ -491,6 +492,12 @@ public:
    */
   void print_dof_info() const;
 
+  /**
+   * \returns The heap memory held by this object's indices, and by
+   * its \p old_dof_object if any, not counting \p sizeof(*this).
+   */
+  std::size_t memory_usage() const;
+
   // Deep copy (or almost-copy) of DofObjects is solely for a couple
   // tricky internal uses.
 private:
@@ -625,9 +632,15 @@ private:
    * [-5 11 11 13 17 () (ncv_0 idx_0 ncv_1 idx_1 ncv_2 idx_2) () (ncv_0 idx_0) (ncv_0 idx_0 ncv_1 idx_1) (xtra1 xtra2)]
    * [0   1  2  3  4         5     6     7     8     9    10         11    12      13    14    15    16      17    18]
    * \endverbatim
+   *
+   * The buffer stores up to \p idx_buf_inline_size entries inline,
+   * which covers e.g. one system with up to two variable groups, or
+   * two systems with one variable group each, so that most objects
+   * need no heap allocation for their indexing.
    */
   typedef dof_id_type index_t;
-  typedef std::vector<index_t> index_buffer_t;
+  static const unsigned int idx_buf_inline_size = 6;
+  typedef SmallVector<index_t, idx_buf_inline_size> index_buffer_t;
   index_buffer_t _idx_buf;
 
   /**
@@ -666,7 +679,7 @@ private:
 #ifdef LIBMESH_IS_UNIT_TESTING
 public:
   void set_buffer (const std::vector<dof_id_type> & buf)
-  { _idx_buf = buf; }
+  { _idx_buf.assign(buf.begin(), buf.end()); }
 #endif
 };
 
@@ -26,9 +26,11 @@
 #include "libmesh/mesh_base.h"
 #include "libmesh/reference_counted_object.h"
 #include "libmesh/auto_ptr.h" // libmesh_make_unique
+#include "libmesh/threads.h"
 
 // C++ Includes
 #include <unordered_map>
+#include <vector>
 
 namespace libMesh
 {
@@ -168,7 +170,8 @@ public:
   GhostingFunctor(const MeshBase & mesh): _mesh(&mesh) {}
 
   /**
-   * Copy Constructor
+   * Copy Constructor.  Cached neighbors are not copied, since a copy
+   * is typically made for use on another mesh.
    */
   GhostingFunctor(const GhostingFunctor & other) :
    ReferenceCountedObject<GhostingFunctor>(other),
@@ -262,8 +265,53 @@ public:
    */
   virtual void delete_remote_elements () {};
 
+  /**
+   * Discards any neighbor lists cached by cached_neighbors().  The
+   * mesh calls this whenever it has changed, before calling
+   * mesh_reinit(), redistribute() or delete_remote_elements().
+   */
+  void clear_neighbor_cache()
+  { _neighbor_cache.clear(); }
+
 protected:
+  /**
+   * \returns The elements found by \p find_neighbors(elem, neighbors)
+   * for \p elem.  Each element's neighbors are only found once per
+   * mesh state, however many times sends lists, sparsity patterns or
+   * remote element deletion ask for them; subclasses should only use
+   * this for results which depend on nothing but the mesh.
+   *
+   * This may be called from multiple threads at once.
+   */
+  template <typename NeighborFinder>
+  const std::vector<const Elem *> &
+  cached_neighbors (const Elem * elem,
+                    NeighborFinder find_neighbors)
+  {
+    {
+      Threads::spin_mutex::scoped_lock lock(Threads::spin_mtx);
+      const auto it = _neighbor_cache.find(elem);
+      if (it != _neighbor_cache.end())
+        return it->second;
+    }
+
+    std::vector<const Elem *> neighbors;
+    find_neighbors(elem, neighbors);
+
+    // Another thread may have beaten us to it, in which case we use
+    // its identical result.  References to unordered_map values
+    // survive rehashing.
+    Threads::spin_mutex::scoped_lock lock(Threads::spin_mtx);
+    return _neighbor_cache.emplace(elem, std::move(neighbors)).first->second;
+  }
+
   const MeshBase * _mesh;
+
+private:
+  /**
+   * Neighbor lists found since the mesh last changed.
+   */
+  std::unordered_map<const Elem *, std::vector<const Elem *>> _neighbor_cache;
 };
 
 } // namespace libMesh
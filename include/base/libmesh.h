@@ -228,7 +228,8 @@ extern const Number imaginary;
  * The command-line is also checked, allowing the user to override the
  * compiled default.  For example, \p --use-petsc will force the use of
  * PETSc solvers, and \p --use-laspack will force the use of LASPACK
- * solvers.
+ * solvers.  \p --use-native-solvers selects libMesh's own threaded
+ * serial solvers, which need no external package.
  */
 SolverPackage default_solver_package ();
 
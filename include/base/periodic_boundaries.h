@@ -29,12 +29,15 @@
 // C++ Includes
 #include <map>
 #include <memory>
+#include <tuple>
+#include <vector>
 
 namespace libMesh
 {
 
 // Forward Declarations
 class Elem;
+class MeshBase;
 class PeriodicBoundaryBase;
 class PointLocatorBase;
 
@@ -69,6 +72,73 @@ public:
                         const Elem * e,
                         unsigned int side,
                         unsigned int * neigh_side = nullptr) const;
+
+  /**
+   * Pairs every active side on a periodic boundary of \p mesh with
+   * the active side its centroid maps onto, by sorting the mapped
+   * centroids, so that subsequent neighbor() calls on that mesh can
+   * look up their answer rather than searching with a point
+   * locator.  Sides whose neighbor is not on this processor, or which
+   * only partially overlap a neighbor side, are left to the point
+   * locator.
+   *
+   * The table holds element pointers, so it must be cleared before
+   * \p mesh is modified; ScopedNeighborTable does this automatically.
+   */
+  void build_neighbor_table(const MeshBase & mesh);
+
+  /**
+   * Discards any table built by build_neighbor_table().
+   */
+  void clear_neighbor_table();
+
+  /**
+   * Builds a neighbor table, if none exists yet, for the lifetime of
+   * this object, during which the mesh must not be modified.
+   */
+  class ScopedNeighborTable
+  {
+  public:
+    ScopedNeighborTable(PeriodicBoundaries & pbs, const MeshBase & mesh);
+
+    ~ScopedNeighborTable();
+
+  private:
+    PeriodicBoundaries & _pbs;
+    bool _built;
+  };
+
+private:
+
+  /**
+   * A periodic side and the side it maps onto.
+   */
+  struct NeighborTableEntry
+  {
+    dof_id_type elem_id;
+    unsigned int side;
+    boundary_id_type boundary_id;
+    const Elem * neighbor;
+    unsigned int neighbor_side;
+
+    bool operator< (const NeighborTableEntry & other) const
+    {
+      return std::tie(elem_id, side, boundary_id) <
+        std::tie(other.elem_id, other.side, other.boundary_id);
+    }
+  };
+
+  /**
+   * Entries for every paired periodic side, sorted by element id,
+   * side and boundary id.
+   */
+  std::vector<NeighborTableEntry> _neighbor_table;
+
+  /**
+   * The mesh \p _neighbor_table was built on, or nullptr if there is
+   * no table.
+   */
+  const MeshBase * _neighbor_table_mesh = nullptr;
 };
 
 } // namespace libMesh
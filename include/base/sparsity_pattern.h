@@ -26,6 +26,7 @@
 
 // C++ includes
 #include <vector>
+#include <unordered_map>
 #include <unordered_set>
 
 namespace libMesh
@@ -50,7 +51,7 @@ namespace SparsityPattern // use a namespace so member classes can be forward-de
 typedef std::vector<dof_id_type, Threads::scalable_allocator<dof_id_type>> Row;
 class Graph : public std::vector<Row> {};
 
-class NonlocalGraph : public std::map<dof_id_type, Row> {};
+class NonlocalGraph : public std::unordered_map<dof_id_type, Row> {};
 
 /**
  * Splices the two sorted ranges [begin,middle) and [middle,end)
@@ -170,6 +171,34 @@ public:
   const std::vector<dof_id_type> & get_n_oz() const
   { return n_oz; }
 
+  /**
+   * A hash of every block of couplings added to this pattern, from
+   * every thread.  It depends only on the dof indices coupled, not on
+   * the order in which elements were visited, so two builds with the
+   * same hash (and the same nonzero counts) found the same pattern
+   * unless the hashes happen to collide.
+   */
+  dof_id_type get_pattern_hash() const
+  { return pattern_hash; }
+
+  /**
+   * Packs the rows of a full sparsity pattern into compressed sparse
+   * row form: the global column indices of local row \p r are
+   * \p column_indices[row_offsets[r]] through
+   * \p column_indices[row_offsets[r+1]-1], in increasing order.
+   *
+   * Both vectors are left empty if only the nonzero counts, not the
+   * full sparsity pattern, have been kept.
+   */
+  void get_csr (std::vector<dof_id_type> & row_offsets,
+                std::vector<dof_id_type> & column_indices) const;
+
+  /**
+   * \returns The heap memory held by the sparsity pattern and the
+   * nonzero counts.
+   */
+  std::size_t memory_usage() const;
+
   /**
    * Let a user-provided AugmentSparsityPattern subclass modify our
    * sparsity structure.
@@ -232,6 +261,8 @@ private:
   std::vector<dof_id_type> n_nz;
 
   std::vector<dof_id_type> n_oz;
+
+  dof_id_type pattern_hash;
 };
 
 }
@@ -29,7 +29,10 @@ namespace libMesh {
 enum class MatrixBuildType
 {
   AUTOMATIC,
-  DIAGONAL
+  DIAGONAL,
+  // A CSRMatrix storing its values in single precision; only
+  // available with NATIVE_SOLVERS
+  SINGLE_PRECISION
 };
 }
 
@@ -39,6 +39,7 @@ enum SolverPackage : int
     SLEPC_SOLVERS,
     EIGEN_SOLVERS,
     NLOPT_SOLVERS,
+    NATIVE_SOLVERS,
     // Invalid
     INVALID_SOLVER_PACKAGE
   };
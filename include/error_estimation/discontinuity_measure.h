@@ -22,6 +22,7 @@
 
 // Local Includes
 #include "libmesh/jump_error_estimator.h"
+#include "libmesh/auto_ptr.h" // libmesh_make_unique
 
 // C++ includes
 #include <cstddef>
@@ -82,6 +83,17 @@ public:
 
 protected:
 
+  /**
+   * \returns A copy of this estimator, for use by another thread.
+   */
+  virtual std::unique_ptr<JumpErrorEstimator> clone () const override
+  {
+    auto copy = libmesh_make_unique<DiscontinuityMeasure>();
+    copy->copy_settings(*this);
+    copy->_bc_function = _bc_function;
+    return std::unique_ptr<JumpErrorEstimator>(std::move(copy));
+  }
+
   /**
    * An initialization function, for requesting specific data from the FE
    * objects
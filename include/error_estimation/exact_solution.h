@@ -111,6 +111,13 @@ public:
    * Attach function similar to system.h which
    * allows the user to attach a second EquationSystems
    * object with a reference fine grid solution.
+   *
+   * If the fine mesh is a refinement of this one, e.g. a copy which
+   * has been uniformly refined, with unique ids preserved, each fine
+   * element is compared against the coarse element it lies in, using
+   * only the ghosted coarse solution.  Otherwise the coarse solution
+   * is serialized on every processor and evaluated with a
+   * MeshFunction.
    */
   void attach_reference_solution (const EquationSystems * es_fine);
 
@@ -22,6 +22,7 @@
 
 // Local Includes
 #include "libmesh/jump_error_estimator.h"
+#include "libmesh/auto_ptr.h" // libmesh_make_unique
 
 // C++ includes
 #include <vector>
@@ -67,6 +68,16 @@ public:
 
 protected:
 
+  /**
+   * \returns A copy of this estimator, for use by another thread.
+   */
+  virtual std::unique_ptr<JumpErrorEstimator> clone () const override
+  {
+    auto copy = libmesh_make_unique<LaplacianErrorEstimator>();
+    copy->copy_settings(*this);
+    return std::unique_ptr<JumpErrorEstimator>(std::move(copy));
+  }
+
   /**
    * An initialization function, for requesting specific data from the FE
    * objects
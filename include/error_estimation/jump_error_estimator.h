@@ -56,6 +56,7 @@ public:
     : ErrorEstimator(),
       scale_by_n_flux_faces(false),
       use_unweighted_quadrature_rules(false),
+      n_chunks(0),
       integrate_boundary_sides(false),
       fine_context(),
       coarse_context(),
@@ -82,6 +83,10 @@ public:
    * estimate formula to estimate the error on each cell.
    * The estimated error is output in the vector
    * \p error_per_cell
+   *
+   * With more than one chunk (see \p n_chunks), and if clone()
+   * provides copies of this estimator, the elements are split among
+   * the threads.  Each face is still integrated only once.
    */
   virtual void estimate_error (const System & system,
                                ErrorVector & error_per_cell,
@@ -112,7 +117,32 @@ public:
    */
   bool use_unweighted_quadrature_rules;
 
+  /**
+   * The number of contiguous chunks the active local elements are
+   * split into, each integrated by its own copy of this estimator,
+   * when clone() provides copies.  The error estimate depends on the
+   * number of chunks only through roundoff.
+   *
+   * The value is initialized to 0, which means one chunk per thread;
+   * set it to 1 to integrate every element with this estimator.
+   */
+  unsigned int n_chunks;
+
 protected:
+  /**
+   * \returns A new estimator with the same settings as this one, for
+   * each thread to integrate with, or nullptr if this estimator must
+   * be used serially.  The default is nullptr, so derived classes
+   * must opt in; their side integration functions will then be
+   * called concurrently on different copies.
+   */
+  virtual std::unique_ptr<JumpErrorEstimator> clone () const { return nullptr; }
+
+  /**
+   * Copies the settings of \p other, as clone() implementations need.
+   */
+  void copy_settings (const JumpErrorEstimator & other);
+
   /**
    * A utility function to reinit the finite element data on elements sharing a
    * side
@@ -166,6 +196,28 @@ protected:
    * The variable number currently being evaluated
    */
   unsigned int var;
+
+private:
+  /**
+   * Collects the error contributions of the elements integrated by
+   * one thread.
+   */
+  struct ErrorAccumulator;
+
+  /**
+   * Builds and initializes the fine and coarse contexts.
+   */
+  void init_contexts (const System & system);
+
+  /**
+   * Integrates the jumps on the sides of \p e for which \p e is
+   * responsible, and on its parent's sides if \p e is the one to
+   * compute on its parent.
+   */
+  void integrate_element (const System & system,
+                          const Elem & e,
+                          bool estimate_parent_error,
+                          ErrorAccumulator & accumulator);
 };
 
 
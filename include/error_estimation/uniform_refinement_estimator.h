@@ -120,6 +120,25 @@ public:
    */
   unsigned char number_p_refinements;
 
+  /**
+   * How many batches to split the refined problem into.  With more
+   * than one batch, the active elements are grouped into patches of
+   * about \p target_patch_size elements, the patches are dealt out
+   * to the batches, and only one batch at a time (plus a buffer layer
+   * of point neighbors) is refined and solved on.  This trades one
+   * solve on a uniformly refined mesh for several smaller solves,
+   * cutting the peak memory use of the estimator.
+   *
+   * Defaults to 1, refining the whole mesh at once.
+   */
+  unsigned int n_patch_batches;
+
+  /**
+   * The number of elements in each patch when \p n_patch_batches is
+   * greater than one.
+   */
+  unsigned int target_patch_size;
+
 protected:
   /**
    * The code for estimate_error and both estimate_errors versions is very
@@ -21,6 +21,7 @@
 #define LIBMESH_FE_H
 
 // Local includes
+#include "libmesh/elem_side_builder.h"
 #include "libmesh/fe_base.h"
 #include "libmesh/int_range.h"
 #include "libmesh/libmesh.h"
@@ -248,6 +249,26 @@ public:
                            std::vector<OutputShape> & v,
                            const bool add_p_level = true);
 
+  /**
+   * Fills \p (*comps[j])[i][qp] with the \f$ j^{th} \f$ derivatives
+   * of every shape function \p i, evaluated at every point qp in p,
+   * for each direction \p j < Dim whose \p comps[j] is not null.
+   * The vectors to be filled should already be the appropriate size.
+   *
+   * Evaluating every shape and derivative in one call lets families
+   * share work between shape functions, such as the 1D bases of
+   * tensor product elements.
+   *
+   * On a p-refined element, \p o should be the base order of the
+   * element if \p add_p_level is left \p true, or can be the base
+   * order of the element if \p add_p_level is set to \p false.
+   */
+  static void all_shape_derivs (const Elem * elem,
+                                const Order o,
+                                const std::vector<Point> & p,
+                                std::vector<std::vector<OutputShape>> * comps[3],
+                                const bool add_p_level = true);
+
 
 #ifdef LIBMESH_ENABLE_SECOND_DERIVATIVES
   /**
@@ -634,18 +655,74 @@ protected:
         v[vi] = FE<Dim,T>::shape_deriv (elem, o, i, j, p[vi], add_p_level);
     }
 
+  /**
+   * A default implementation for all_shape_derivs
+   */
+  static void default_all_shape_derivs (const Elem * elem,
+                                        const Order o,
+                                        const std::vector<Point> & p,
+                                        std::vector<std::vector<OutputShape>> * comps[3],
+                                        const bool add_p_level = true)
+    {
+      for (unsigned int j = 0; j != Dim; ++j)
+        if (comps[j])
+          for (auto i : index_range(*comps[j]))
+            FE<Dim,T>::shape_derivs (elem, o, i, j, p, (*comps[j])[i], add_p_level);
+    }
+
+  /**
+   * Fills the reference element shape function data requested by
+   * init_shape_functions() at the points \p qp from the process-wide
+   * reference shape cache.
+   *
+   * \returns \p true on a cache hit, \p false if the data must be
+   * computed (and then stored with cache_reference_shapes()).
+   */
+  bool reference_shapes_from_cache(const std::vector<Point> & qp,
+                                   const Elem * elem);
+
+  /**
+   * Stores the reference element shape function data just computed
+   * by init_shape_functions() at the points \p qp in the process-wide
+   * reference shape cache.
+   */
+  void cache_reference_shapes(const std::vector<Point> & qp,
+                              const Elem * elem);
+
   /**
    * An array of the node locations on the last
    * element we computed on
    */
   std::vector<Point> cached_nodes;
 
+  /**
+   * True while init_shape_functions() is being called on the points
+   * of a quadrature rule (interior or mapped side), whose
+   * reference shape data is worth sharing between FE objects.
+   * Arbitrary user-supplied points are never cached.
+   */
+  bool reference_points_on_quadrature;
+
   /**
    * The last side and last edge we did a reinit on
    */
   ElemType last_side;
 
   unsigned int last_edge;
+
+  /**
+   * Builds the sides we reinit on without allocating a new side
+   * element each time
+   */
+  ElemSideBuilder side_builder;
+
+  /**
+   * Scratch storage for side reinits, kept between calls so that
+   * loops over sides don't allocate
+   */
+  std::vector<Point> side_qp;
+  std::vector<Point> side_refspace_nodes;
+  std::vector<Real> side_JxW;
 };
 
 
@@ -1280,6 +1357,18 @@ void FE<MyDim,MyType>::shape_derivs                  \
 {                                                    \
   FE<MyDim,MyType>::default_shape_derivs             \
     (elem,o,i,j,p,v,add_p_level);                    \
+}                                                    \
+                                                     \
+template<>                                           \
+void FE<MyDim,MyType>::all_shape_derivs              \
+  (const Elem * elem,                                \
+   const Order o,                                    \
+   const std::vector<Point> & p,                     \
+   std::vector<std::vector<OutputShape>> * comps[3], \
+   const bool add_p_level)                           \
+{                                                    \
+  FE<MyDim,MyType>::default_all_shape_derivs         \
+    (elem,o,p,comps,add_p_level);                    \
 }
 
 
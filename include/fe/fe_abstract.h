@@ -519,6 +519,34 @@ public:
   const FEMap & get_fe_map() const { return *_fe_map.get(); }
   FEMap & get_fe_map() { return *_fe_map.get(); }
 
+  /**
+   * Base class for the data computed by a reinit(): the mapping, the
+   * shape functions and their derivatives.
+   */
+  class ReinitData
+  {
+  public:
+    virtual ~ReinitData() = default;
+  };
+
+  /**
+   * Copies the data computed by the most recent reinit() into
+   * \p data, allocating \p data first if it is null.
+   */
+  virtual void save_reinit_data (std::unique_ptr<ReinitData> & data) const = 0;
+
+  /**
+   * Replaces the data computed by the most recent reinit() with
+   * \p data, saved by save_reinit_data() from an FE object of the
+   * same type which requested the same quantities.  This is much
+   * cheaper than a reinit() on an element whose geometry has not
+   * changed since \p data was saved.
+   *
+   * References previously returned by get_phi(), get_JxW() etc.
+   * remain valid.
+   */
+  virtual void restore_reinit_data (const ReinitData & data) = 0;
+
   /**
    * Prints the Jacobian times the weight for each quadrature point.
    */
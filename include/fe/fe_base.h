@@ -24,6 +24,7 @@
 #include "libmesh/libmesh_common.h"
 #include "libmesh/compare_types.h"
 #include "libmesh/fe_abstract.h"
+#include "libmesh/fe_shape_table.h"
 #include "libmesh/fe_transformation_base.h"
 #include "libmesh/point.h"
 #include "libmesh/reference_counted_object.h"
@@ -219,6 +220,18 @@ public:
     return dual_phi;
   }
 
+  /**
+   * \returns The shape function values at the quadrature points on
+   * the element, in a contiguous \p [n_dofs x n_qp] table which
+   * supports the same \p phi[i][qp] indexing as get_phi().
+   *
+   * The table is copied from get_phi() the first time it is asked
+   * for after each reinit(), so reinits whose table is never read
+   * cost nothing extra.  The reference returned stays valid, but
+   * call this again after each reinit() to bring it up to date.
+   */
+  const FEShapeTable<OutputShape> & get_phi_table() const;
+
   void request_phi() const override
   { get_phi(); }
 
@@ -237,6 +250,14 @@ public:
   { libmesh_assert(!calculations_started || calculate_dphi);
     calculate_dphi = calculate_dual = calculate_dphiref = true; return dual_dphi; }
 
+  /**
+   * \returns The shape function derivatives at the quadrature
+   * points, in a contiguous \p [n_dofs x n_qp] table which supports
+   * the same \p dphi[i][qp] indexing as get_dphi().  Like
+   * get_phi_table(), it is only copied when asked for.
+   */
+  const FEShapeTable<OutputGradient> & get_dphi_table() const;
+
   void request_dphi() const override
   { get_dphi(); }
 
@@ -539,9 +560,18 @@ public:
 
 #endif
 
+  virtual void save_reinit_data (std::unique_ptr<FEAbstract::ReinitData> & data) const override;
+
+  virtual void restore_reinit_data (const FEAbstract::ReinitData & data) override;
+
 
 protected:
 
+  /**
+   * The data saved by save_reinit_data()
+   */
+  struct SavedReinitData;
+
 
 
 #ifdef LIBMESH_ENABLE_INFINITE_ELEMENTS
@@ -589,6 +619,14 @@ protected:
    */
   virtual void compute_shape_functions(const Elem * elem, const std::vector<Point> & qp) override;
 
+  /**
+   * Marks the contiguous tables of \p phi and \p dphi as out of
+   * date, so they are copied again when next asked for.  Should be
+   * called by every compute_shape_functions() implementation.
+   */
+  void invalidate_shape_tables()
+  { phi_table_current = dphi_table_current = false; }
+
   /**
    * Compute the dual basis coefficients \p dual_coeff
    */
@@ -619,6 +657,26 @@ protected:
   std::vector<std::vector<OutputGradient>>  dphi;
   std::vector<std::vector<OutputGradient>>  dual_dphi;
 
+  /**
+   * Contiguous copies of \p phi and \p dphi, made lazily by
+   * get_phi_table() and get_dphi_table().
+   */
+  mutable FEShapeTable<OutputShape> phi_table;
+  mutable FEShapeTable<OutputGradient> dphi_table;
+
+  /**
+   * Do the contiguous tables hold the values of the last reinit?
+   */
+  mutable bool phi_table_current, dphi_table_current;
+
+  /**
+   * Set by init_shape_functions() when it has already filled \p phi
+   * with values which need no mapping to the physical element, so
+   * that compute_shape_functions() needn't recompute them on every
+   * element.
+   */
+  bool phi_computed_by_init;
+
   /**
    * Coefficient matrix for the dual basis.
    */
@@ -831,6 +889,11 @@ FEGenericBase<OutputType>::FEGenericBase(const unsigned int d,
   dual_phi(),
   dphi(),
   dual_dphi(),
+  phi_table(),
+  dphi_table(),
+  phi_table_current(false),
+  dphi_table_current(false),
+  phi_computed_by_init(false),
   curl_phi(),
   div_phi(),
   dphidxi(),
@@ -484,6 +484,41 @@ public:
                          std::vector<std::vector<OutputType>> & phi,
                          const bool add_p_level = true);
 
+  /**
+   * Fills \p dphi with the \f$ j^{th} \f$ derivative of the
+   * \f$ i^{th} \f$ shape function at every point in \p p, with a
+   * single dispatch to the appropriate finite element class.
+   * \p dphi should already be the appropriate size.
+   */
+  template<typename OutputType>
+  static void shape_derivs(const unsigned int dim,
+                           const FEType & fe_t,
+                           const Elem * elem,
+                           const unsigned int i,
+                           const unsigned int j,
+                           const std::vector<Point> & p,
+                           std::vector<OutputType> & dphi,
+                           const bool add_p_level = true);
+
+  /**
+   * Fills \p (*comps[j])[i][qp] with the \f$ j^{th} \f$ derivative
+   * of every shape function \p i at every point qp in \p p, for each
+   * direction \p j < \p dim whose \p comps[j] is not null, with a
+   * single dispatch to the appropriate finite element class.  This
+   * is the batch equivalent of calling shape_deriv() for every shape,
+   * point, and direction, and is much cheaper for families whose
+   * implementation can share work between them.
+   *
+   * The vectors to be filled should already be the appropriate size.
+   */
+  template<typename OutputType>
+  static void all_shape_derivs(const unsigned int dim,
+                               const FEType & fe_t,
+                               const Elem * elem,
+                               const std::vector<Point> & p,
+                               std::vector<std::vector<OutputType>> * comps[3],
+                               const bool add_p_level = true);
+
   /**
    * Typedef for pointer to a function that returns FE shape function values.
    * The \p p_level() of the passed-in \p elem is accounted for internally when
@@ -24,6 +24,9 @@
 #include "libmesh/enum_order.h"
 #include "libmesh/point.h"
 
+// C++ includes
+#include <vector>
+
 // Inline functions useful to inline on tensor elements.
 
 namespace libMesh
@@ -318,6 +321,95 @@ Real fe_lagrange_1D_shape_second_deriv(const Order order,
 
 #endif // LIBMESH_ENABLE_SECOND_DERIVATIVES
 
+
+
+/**
+ * Evaluates the \p n_shapes tensor product Lagrange shape functions
+ * whose 1D node in each direction d is \p node_index[d][i] at every
+ * point in \p p, filling \p phi (if not null) and any non-null
+ * \p dphi[d] with the values and first reference derivatives.
+ *
+ * Each 1D basis function is evaluated only once per point and
+ * direction, and the tensor products are formed in loops over
+ * contiguous point data which the compiler can vectorize.  The
+ * vectors to be filled should already be the appropriate size.
+ */
+template <unsigned int Dim>
+inline
+void fe_lagrange_tensor_shapes(const Order order,
+                               const unsigned int n_shapes,
+                               const unsigned int * const node_index[Dim],
+                               const std::vector<Point> & p,
+                               std::vector<std::vector<Real>> * phi,
+                               std::vector<std::vector<Real>> * const dphi[Dim])
+{
+  const std::size_t n_pts = p.size();
+  if (!n_pts)
+    return;
+
+  const unsigned int n_1d = static_cast<unsigned int>(order) + 1;
+
+  bool need_derivs = false;
+  for (unsigned int d = 0; d != Dim; ++d)
+    if (dphi && dphi[d])
+      need_derivs = true;
+
+  // 1D values and derivatives, at [(d*n_1d + k)*n_pts + qp]
+  std::vector<Real> vals(Dim*n_1d*n_pts), derivs;
+  if (need_derivs)
+    derivs.resize(vals.size());
+
+  for (unsigned int d = 0; d != Dim; ++d)
+    for (unsigned int k = 0; k != n_1d; ++k)
+      {
+        const std::size_t offset = (d*n_1d + k)*n_pts;
+        for (std::size_t qp = 0; qp != n_pts; ++qp)
+          vals[offset + qp] = fe_lagrange_1D_shape(order, k, p[qp](d));
+        if (need_derivs)
+          for (std::size_t qp = 0; qp != n_pts; ++qp)
+            derivs[offset + qp] = fe_lagrange_1D_shape_deriv(order, k, 0, p[qp](d));
+      }
+
+  for (unsigned int i = 0; i != n_shapes; ++i)
+    {
+      const Real * v[Dim];
+      const Real * dv[Dim];
+      for (unsigned int d = 0; d != Dim; ++d)
+        {
+          const std::size_t offset = (d*n_1d + node_index[d][i])*n_pts;
+          v[d] = vals.data() + offset;
+          dv[d] = need_derivs ? derivs.data() + offset : nullptr;
+        }
+
+      if (phi)
+        {
+          libmesh_assert_equal_to ((*phi)[i].size(), n_pts);
+          Real * out = (*phi)[i].data();
+          for (std::size_t qp = 0; qp != n_pts; ++qp)
+            {
+              Real val = v[0][qp];
+              for (unsigned int d = 1; d != Dim; ++d)
+                val *= v[d][qp];
+              out[qp] = val;
+            }
+        }
+
+      for (unsigned int j = 0; j != Dim; ++j)
+        if (dphi && dphi[j])
+          {
+            libmesh_assert_equal_to ((*dphi[j])[i].size(), n_pts);
+            Real * out = (*dphi[j])[i].data();
+            for (std::size_t qp = 0; qp != n_pts; ++qp)
+              {
+                Real val = 1;
+                for (unsigned int d = 0; d != Dim; ++d)
+                  val *= (d == j) ? dv[d][qp] : v[d][qp];
+                out[qp] = val;
+              }
+          }
+    }
+}
+
 }
 
 #endif // LIBMESH_FE_LAGRANGE_SHAPE_1D_H
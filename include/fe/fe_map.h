@@ -195,6 +195,11 @@ public:
    * reference element are returned in the vector \p
    * reference_points. The other parameters have the same meaning
    * as the single Point version of inverse_map() above.
+   *
+   * The Newton iterations for all the points advance together, with
+   * the mapping shape functions looked up once per element rather
+   * than once per point and iteration, and converged points drop out
+   * of later sweeps.
    */
   static void inverse_map (unsigned int dim,
                            const Elem * elem,
@@ -204,6 +209,20 @@ public:
                            const bool secure = true,
                            const bool extra_checks = true);
 
+  /**
+   * Finds the reference element locations \p reference_points[e] of
+   * the points \p physical_points[e] on each element \p elems[e], of
+   * its own dimension, with the elements divided among threads.
+   * The other parameters have the same meaning as in the single
+   * element inverse_map() above; the extra DEBUG mode checks are not
+   * done.
+   */
+  static void inverse_map (const std::vector<const Elem *> & elems,
+                           const std::vector<std::vector<Point>> & physical_points,
+                           std::vector<std::vector<Point>> & reference_points,
+                           const Real tolerance = TOLERANCE,
+                           const bool secure = true);
+
   /**
    * \returns The \p xyz spatial locations of the quadrature
    * points on the element.
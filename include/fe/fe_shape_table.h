@@ -0,0 +1,249 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_FE_SHAPE_TABLE_H
+#define LIBMESH_FE_SHAPE_TABLE_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+
+// C++ includes
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace libMesh
+{
+
+/**
+ * The \p FEShapeTable class stores a table of shape function data,
+ * indexed by shape function and then by quadrature point, in a
+ * single contiguous allocation.
+ *
+ * Each row (one shape function's values at every quadrature point)
+ * starts on a \p FEShapeTable::alignment byte boundary whenever the
+ * size of \p T evenly divides that alignment, so that loops over
+ * quadrature points in user kernels can be vectorized.  Rows are
+ * accessed through lightweight views, so that existing code written
+ * as \p phi[i][qp] compiles unchanged against a table.
+ *
+ * Resizing a table to the same or to smaller dimensions does not
+ * reallocate.
+ *
+ * \brief Contiguous storage for shape function values.
+ */
+template <typename T>
+class FEShapeTable
+{
+public:
+
+  /**
+   * The byte alignment of each row, when achievable for \p T.
+   */
+  static const std::size_t alignment = 64;
+
+  /**
+   * A read-only view of the values of one shape function at every
+   * quadrature point.
+   */
+  class ConstRow
+  {
+  public:
+    ConstRow (const T * data, unsigned int n) : _data(data), _n(n) {}
+
+    const T & operator[] (unsigned int qp) const
+    { libmesh_assert_less (qp, _n); return _data[qp]; }
+
+    unsigned int size () const { return _n; }
+    bool empty () const { return !_n; }
+
+    const T * data () const { return _data; }
+    const T * begin () const { return _data; }
+    const T * end () const { return _data + _n; }
+
+  private:
+    const T * _data;
+    unsigned int _n;
+  };
+
+  /**
+   * A writable view of the values of one shape function at every
+   * quadrature point.
+   */
+  class Row
+  {
+  public:
+    Row (T * data, unsigned int n) : _data(data), _n(n) {}
+
+    T & operator[] (unsigned int qp) const
+    { libmesh_assert_less (qp, _n); return _data[qp]; }
+
+    operator ConstRow () const { return ConstRow(_data, _n); }
+
+    unsigned int size () const { return _n; }
+    bool empty () const { return !_n; }
+
+    T * data () const { return _data; }
+    T * begin () const { return _data; }
+    T * end () const { return _data + _n; }
+
+  private:
+    T * _data;
+    unsigned int _n;
+  };
+
+  FEShapeTable () : _n_shapes(0), _n_qp(0), _stride(0), _offset(0) {}
+
+  /**
+   * Copies get their own storage, with their own alignment offset,
+   * so we copy values row by row.
+   */
+  FEShapeTable (const FEShapeTable & other) :
+    FEShapeTable()
+  { *this = other; }
+
+  FEShapeTable & operator= (const FEShapeTable & other)
+  {
+    if (this != &other)
+      {
+        this->resize(other._n_shapes, other._n_qp);
+        for (unsigned int i = 0; i != _n_shapes; ++i)
+          for (unsigned int qp = 0; qp != _n_qp; ++qp)
+            (*this)[i][qp] = other[i][qp];
+      }
+    return *this;
+  }
+
+  /**
+   * Resizes the table to hold \p n_shapes rows of \p n_qp values.
+   * Existing values are not preserved.
+   */
+  void resize (unsigned int n_shapes, unsigned int n_qp)
+  {
+    _n_shapes = n_shapes;
+    _n_qp = n_qp;
+
+    // Pad each row out to a whole number of alignment blocks when
+    // that's possible for this type
+    const std::size_t per_block =
+      (alignment % sizeof(T)) ? 1 : alignment / sizeof(T);
+    _stride = (n_qp + per_block - 1) / per_block * per_block;
+
+    // Over-allocate by one block so we can shift the start of the
+    // table to an aligned address.
+    const std::size_t needed = std::size_t(_stride) * n_shapes + per_block;
+    if (_values.size() < needed)
+      _values.resize(needed);
+
+    _offset = 0;
+    if (per_block > 1)
+      {
+        const std::uintptr_t address =
+          reinterpret_cast<std::uintptr_t>(_values.data());
+        _offset = ((alignment - address % alignment) % alignment) / sizeof(T);
+      }
+  }
+
+  /**
+   * Sets every value in the table to \p val, without resizing.
+   */
+  void fill (const T & val)
+  {
+    for (unsigned int i = 0; i != _n_shapes; ++i)
+      for (auto & v : (*this)[i])
+        v = val;
+  }
+
+  /**
+   * Resizes the table to match the nested vector \p nested, which
+   * must have the same number of values for each shape, and copies
+   * its values.
+   */
+  void assign (const std::vector<std::vector<T>> & nested)
+  {
+    const unsigned int n_shapes = cast_int<unsigned int>(nested.size());
+    const unsigned int n_qp = n_shapes ?
+      cast_int<unsigned int>(nested[0].size()) : 0;
+
+    this->resize(n_shapes, n_qp);
+
+    for (unsigned int i = 0; i != n_shapes; ++i)
+      {
+        libmesh_assert_equal_to (nested[i].size(), n_qp);
+        T * row = this->row_data(i);
+        for (unsigned int qp = 0; qp != n_qp; ++qp)
+          row[qp] = nested[i][qp];
+      }
+  }
+
+  /**
+   * \returns A view of the values of shape function \p i.
+   */
+  ConstRow operator[] (unsigned int i) const
+  { libmesh_assert_less (i, _n_shapes); return ConstRow(this->row_data(i), _n_qp); }
+
+  Row operator[] (unsigned int i)
+  { libmesh_assert_less (i, _n_shapes); return Row(this->row_data(i), _n_qp); }
+
+  /**
+   * \returns The number of shape functions in the table, for
+   * compatibility with code which expects a nested std::vector.
+   */
+  unsigned int size () const { return _n_shapes; }
+
+  bool empty () const { return !_n_shapes; }
+
+  unsigned int n_shapes () const { return _n_shapes; }
+
+  unsigned int n_qp () const { return _n_qp; }
+
+  /**
+   * \returns The distance, in values, between the starts of
+   * consecutive rows.  This is at least \p n_qp().
+   */
+  unsigned int stride () const { return _stride; }
+
+  /**
+   * \returns A pointer to the start of the table; row \p i begins
+   * at data() + i*stride().
+   */
+  const T * data () const { return _values.data() + _offset; }
+  T * data () { return _values.data() + _offset; }
+
+private:
+
+  const T * row_data (unsigned int i) const
+  { return this->data() + std::size_t(i) * _stride; }
+
+  T * row_data (unsigned int i)
+  { return this->data() + std::size_t(i) * _stride; }
+
+  unsigned int _n_shapes, _n_qp, _stride;
+
+  std::size_t _offset;
+
+  std::vector<T> _values;
+};
+
+template <typename T>
+const std::size_t FEShapeTable<T>::alignment;
+
+} // namespace libMesh
+
+#endif // LIBMESH_FE_SHAPE_TABLE_H
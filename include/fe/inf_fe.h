@@ -902,11 +902,9 @@ protected:
 
   /**
    * Does the same as \p compute_node_indices(), but stores
-   * the maps for the current element type.  Provided the
-   * infinite element type changes seldom, this is probably
-   * faster than using \p compute_node_indices () alone.
-   * This is possible since the number of nodes is not likely
-   * to change.
+   * the maps for each element type the first time it is seen,
+   * so later calls are table lookups.  Safe to call from
+   * multiple threads.
    */
   static void compute_node_indices_fast (const ElemType inf_elem_type,
                                          const unsigned int outer_node_index,
@@ -1124,15 +1122,6 @@ private:
    */
   virtual bool shapes_need_reinit() const override;
 
-  /**
-   * When \p compute_node_indices_fast() is used, this static
-   * variable remembers the element type for which the
-   * static variables in  \p compute_node_indices_fast()
-   * are currently set.  Using a class member for the
-   * element type helps initializing it to a default value.
-   */
-  static ElemType _compute_node_indices_fast_current_elem_type;
-
 
 #ifdef DEBUG
 
@@ -0,0 +1,245 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_TENSOR_PRODUCT_KERNEL_H
+#define LIBMESH_TENSOR_PRODUCT_KERNEL_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/enum_elem_type.h"
+#include "libmesh/fe_type.h"
+#include "libmesh/point.h"
+
+// C++ includes
+#include <memory>
+#include <vector>
+
+namespace libMesh
+{
+
+// Forward declarations
+class Elem;
+class Node;
+template <typename T> class DenseVectorBase;
+
+/**
+ * The \p TensorProductKernel class applies element operators for
+ * finite element spaces on tensor product elements (quadrilaterals
+ * and hexahedra) by sum factorization.
+ *
+ * Where the shape functions of the element are (up to sign) products
+ * of the shape functions of the same family on an edge, as is the
+ * case for LAGRANGE on Quad4/Quad9/Hex8/Hex27 and for HIERARCHIC,
+ * interpolating a solution to the quadrature points or integrating
+ * against every test function can be done one direction at a time,
+ * in O(p^{d+1}) rather than O(p^{2d}) operations per element.
+ *
+ * The quadrature points are the tensor product Gauss points, in the
+ * same order as a \p QGauss rule of the same order on the element.
+ * Operations work with derivatives on the reference element; users
+ * apply the inverse map Jacobian (e.g. from an \p FEMap reinit with
+ * no shape function calculations requested) at each point.
+ *
+ * A typical matrix-free residual evaluation in an
+ * element_time_derivative() is then:
+ * \code
+ * if (kernel.reinit(c.get_elem()))
+ *   {
+ *     kernel.interpolate_gradient(c.get_elem_solution(u_var), grad_u);
+ *     // ... form reference fluxes at each point, scaled by JxW ...
+ *     kernel.integrate_gradient(fluxes, c.get_elem_residual(u_var));
+ *   }
+ * \endcode
+ *
+ * Each kernel keeps scratch storage, so each thread should use its
+ * own kernel, e.g. one per FEMContext.
+ *
+ * \brief Sum-factorized operator application on tensor product elements.
+ */
+class TensorProductKernel
+{
+public:
+
+  /**
+   * Constructor.  The kernel will evaluate \p fe_type on
+   * \p dim dimensional elements, with a Gauss rule of order \p q_order.
+   */
+  TensorProductKernel (const FEType & fe_type,
+                       const unsigned int dim,
+                       const Order q_order);
+
+  ~TensorProductKernel ();
+
+  /**
+   * Prepares the kernel for use on \p elem.  The tensor product
+   * structure of the basis is found the first time each element type
+   * and p level is seen; later calls only check the orientation of
+   * the element's shape functions.
+   *
+   * \returns \p false if the basis on \p elem is not a tensor product
+   * of edge bases, in which case the caller should fall back to a
+   * standard FE reinit.
+   */
+  bool reinit (const Elem & elem);
+
+  /**
+   * \returns The number of shape functions on the current element.
+   */
+  unsigned int n_shapes () const
+  { return cast_int<unsigned int>(_index.size()); }
+
+  /**
+   * \returns The number of quadrature points on the current element.
+   */
+  unsigned int n_points () const
+  { return cast_int<unsigned int>(_points.size()); }
+
+  /**
+   * \returns The quadrature points on the reference element.
+   */
+  const std::vector<Point> & get_points () const { return _points; }
+
+  /**
+   * \returns The quadrature weights on the reference element.
+   */
+  const std::vector<Real> & get_weights () const { return _weights; }
+
+  /**
+   * Sets \p values to the values at each quadrature point of the
+   * finite element function with coefficients \p coefs.
+   */
+  void interpolate (const DenseVectorBase<Number> & coefs,
+                    std::vector<Number> & values) const;
+
+  /**
+   * Sets \p grads[j] to the reference derivatives in direction \p j
+   * at each quadrature point of the finite element function with
+   * coefficients \p coefs.
+   */
+  void interpolate_gradient (const DenseVectorBase<Number> & coefs,
+                             std::vector<std::vector<Number>> & grads) const;
+
+  /**
+   * Adds the integral of \p values times each shape function to
+   * \p residual.  \p values should already include quadrature weights
+   * and Jacobians.
+   */
+  void integrate (const std::vector<Number> & values,
+                  DenseVectorBase<Number> & residual) const;
+
+  /**
+   * Adds the integral of \p fluxes[j] times the reference derivative
+   * in direction \p j of each shape function, summed over directions,
+   * to \p residual.  \p fluxes should already include quadrature
+   * weights and Jacobians.
+   */
+  void integrate_gradient (const std::vector<std::vector<Number>> & fluxes,
+                           DenseVectorBase<Number> & residual) const;
+
+private:
+
+  /**
+   * \returns \p n to the power of the element dimension.
+   */
+  unsigned int n_tensor (unsigned int n) const
+  { return (_dim == 1) ? n : (_dim == 2) ? n*n : n*n*n; }
+
+  /**
+   * Builds the 1D basis tables for the edge element matching \p elem
+   * at order \p order.
+   */
+  bool build_tables (const Elem & elem, const Order order);
+
+  /**
+   * Finds the lexicographic tensor product index and sign of each
+   * shape function on \p elem.
+   */
+  bool build_index (const Elem & elem);
+
+  /**
+   * Updates the shape function signs for the orientation of \p elem.
+   */
+  bool update_signs (const Elem & elem);
+
+  /**
+   * Applies the 1D tables along each axis of \p in, either from
+   * coefficients to quadrature points or (if \p transpose) back,
+   * using the derivative table along axis \p deriv_axis (if any).
+   */
+  void apply (const std::vector<Number> & in,
+              std::vector<Number> & out,
+              bool transpose,
+              unsigned int deriv_axis) const;
+
+  const FEType _fe_type;
+
+  const unsigned int _dim;
+
+  const Order _q_order;
+
+  /**
+   * The element type and p level the current tables are for
+   */
+  ElemType _elem_type;
+  unsigned int _p_level;
+  bool _valid;
+
+  /**
+   * A reference edge element, and its nodes, to evaluate the 1D basis
+   */
+  std::vector<std::unique_ptr<Node>> _edge_nodes;
+  std::unique_ptr<Elem> _edge;
+
+  /**
+   * The 1D Gauss points and weights
+   */
+  std::vector<Real> _q1d_points, _q1d_weights;
+
+  /**
+   * The tensor product points and weights
+   */
+  std::vector<Point> _points;
+  std::vector<Real> _weights;
+
+  /**
+   * The number of 1D shape functions and quadrature points
+   */
+  unsigned int _n1, _nq;
+
+  /**
+   * 1D shape function values and derivatives, at [qp*_n1 + i]
+   */
+  std::vector<Real> _values_1d, _derivs_1d;
+
+  /**
+   * The lexicographic tensor product index and the sign of each
+   * shape function on the current element
+   */
+  std::vector<unsigned int> _index;
+  std::vector<Real> _sign;
+
+  /**
+   * Scratch space for tensor contractions
+   */
+  mutable std::vector<Number> _coefs, _work1, _work2;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_TENSOR_PRODUCT_KERNEL_H
@@ -916,6 +916,15 @@ public:
    */
   virtual Real quality (const ElemQuality q) const;
 
+  /**
+   * Fills \p values[i] with quality(\p metrics[i]) for each requested
+   * metric.  Element types which can share intermediate quantities,
+   * e.g. edge and diagonal lengths, between several metrics override
+   * this to compute them only once.
+   */
+  virtual void qualities (const std::vector<ElemQuality> & metrics,
+                          std::vector<Real> & values) const;
+
   /**
    * \returns The suggested quality bounds for the Elem based on
    * quality measure \p q.
@@ -28,10 +28,20 @@
 #include "libmesh/libmesh_common.h"
 #include "libmesh/point.h"
 
+#ifdef LIBMESH_FORWARD_DECLARE_ENUMS
+namespace libMesh
+{
+enum ElemType : int;
+}
+#else
+#include "libmesh/enum_elem_type.h"
+#endif
+
 // TIMPI includes
 #include "timpi/communicator.h"
 
 // C++ includes
+#include <initializer_list>
 #include <vector>
 #include <memory>
 
@@ -40,6 +50,7 @@ namespace libMesh
 
 // Forward declarations
 class Elem;
+class Node;
 class ReplicatedMesh;
 class TriangleInterface;
 class TetGenMeshInterface;
@@ -54,6 +65,12 @@ class SerialMesh;
  * interfaces, the former of which is only defined if libmesh is configured
  * with --disable-strict-lgpl.
  *
+ * First order triangles and tetrahedra with no vertex exactly on the
+ * interface are cut directly, into one or three subelements on each
+ * side, without calling either mesh generator.  That path shares no
+ * state between ElemCutter objects, so separate cutters may be used
+ * on separate threads.
+ *
  * \author Benjamin S. Kirk
  * \date 2013
  * \brief Subdivides a single element using a mesh generator.
@@ -127,6 +144,25 @@ public:
 
 protected:
 
+  /**
+   * Cuts TRI3 and TET4 elements with no zero vertex values directly
+   * into simplices.
+   *
+   * \returns \p false, having done nothing, for any other element.
+   */
+  bool cut_simplex(const Elem & elem,
+                   const std::vector<Real> & vertex_distance_func);
+
+  /**
+   * \returns Subelement \p i of type \p type, with nodes
+   * \p nodes, reusing any previously built subelement storage.
+   * The subelement is reoriented if needed to match \p elem.
+   */
+  const Elem * build_simplex(const Elem & elem,
+                             unsigned int i,
+                             ElemType type,
+                             std::initializer_list<unsigned int> nodes);
+
   /**
    * Finds the points where the cutting surface
    * intersects the element edges.
@@ -170,6 +206,13 @@ protected:
   std::unique_ptr<TetGenMeshInterface> _tetgen_outside;
 
   std::vector<Point> _intersection_pts;
+
+  /**
+   * Storage for the vertices, edge intersections and subelements
+   * made by cut_simplex().
+   */
+  std::vector<std::unique_ptr<Node>> _simplex_nodes;
+  std::vector<std::unique_ptr<Elem>> _simplex_elems;
 };
 
 
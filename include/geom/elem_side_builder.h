@@ -0,0 +1,82 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_ELEM_SIDE_BUILDER_H
+#define LIBMESH_ELEM_SIDE_BUILDER_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/enum_elem_type.h"
+
+// C++ includes
+#include <memory>
+#include <vector>
+
+namespace libMesh
+{
+
+// Forward declarations
+class Elem;
+
+/**
+ * The \p ElemSideBuilder class builds the sides of elements, reusing
+ * one side element of each type rather than allocating a new side on
+ * every call as \p Elem::build_side_ptr() does.  Once a side of each
+ * type in a loop has been seen, building further sides does no heap
+ * allocation.
+ *
+ * The returned side is only valid until the next call that builds a
+ * side of the same type.  Each thread should use its own builder,
+ * e.g. one per FE object.
+ *
+ * \brief Allocation-free construction of element sides.
+ */
+class ElemSideBuilder
+{
+public:
+
+  ElemSideBuilder ();
+
+  ~ElemSideBuilder ();
+
+  /**
+   * \returns A non-proxy element for side \p s of \p elem, with its
+   * interior parent set to \p elem.  This is equivalent to
+   * \p *elem.build_side_ptr(s), except for its lifetime.
+   */
+  Elem & operator() (Elem & elem, const unsigned int s);
+
+  const Elem & operator() (const Elem & elem, const unsigned int s);
+
+private:
+
+  /**
+   * The type of each side of each element type, once known
+   */
+  std::vector<std::vector<ElemType>> _side_types;
+
+  /**
+   * The cached side element of each type
+   */
+  std::vector<std::unique_ptr<Elem>> _sides;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_ELEM_SIDE_BUILDER_H
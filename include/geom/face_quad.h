@@ -176,6 +176,13 @@ public:
    */
   virtual Real quality (const ElemQuality q) const override;
 
+  /**
+   * Computes several quality metrics at once, sharing the edge and
+   * diagonal lengths between those which use them.
+   */
+  virtual void qualities (const std::vector<ElemQuality> & metrics,
+                          std::vector<Real> & values) const override;
+
   /**
    * \returns The suggested quality bounds for
    * the hex based on quality measure q.  These are
@@ -25,11 +25,16 @@
 
 // C++ includes
 #include <fstream>
+#include <memory>
 #include <set>
+#include <unordered_map>
 
 namespace libMesh
 {
 
+// Forward declarations
+class AsciiTokenizer;
+
 /**
  * The AbaqusIO class is a preliminary implementation for reading
  * Abaqus mesh files in ASCII format.
@@ -203,7 +208,12 @@ private:
   /**
    * Stream object used to interact with the file
    */
-  std::ifstream _in;
+  std::ifstream _in_stream;
+
+  /**
+   * Reads from _in_stream, parsing numbers from memory
+   */
+  std::unique_ptr<AsciiTokenizer> _in;
 
   /**
    * A set of the different geometric element types detected when reading the
@@ -216,7 +226,7 @@ private:
    * and the converse.
    */
   // std::map<dof_id_type, dof_id_type> _libmesh_to_abaqus_elem_mapping;
-  std::map<dof_id_type, dof_id_type> _abaqus_to_libmesh_elem_mapping;
+  std::unordered_map<dof_id_type, dof_id_type> _abaqus_to_libmesh_elem_mapping;
 
   /**
    * Map from abaqus node number -> sequential, 0-based libmesh node numbering.
@@ -226,7 +236,7 @@ private:
    * Nevertheless, it is the most general solution in case we come across a
    * weird Abaqus file some day.
    */
-  std::map<dof_id_type, dof_id_type> _abaqus_to_libmesh_node_mapping;
+  std::unordered_map<dof_id_type, dof_id_type> _abaqus_to_libmesh_node_mapping;
 
   /**
    * This flag gets set to true after the first "*PART" section
@@ -24,6 +24,7 @@
 #include "libmesh/libmesh_common.h"
 #include "libmesh/id_types.h"
 #include "libmesh/parallel_object.h"
+#include "libmesh/flat_multimap.h"
 
 // C++ includes
 #include <cstddef>
@@ -40,6 +41,7 @@ namespace libMesh
 class Elem;
 class Node;
 class MeshBase;
+class MemoryUsage;
 class UnstructuredMesh;
 
 
@@ -137,6 +139,15 @@ public:
              UnstructuredMesh & boundary_mesh,
              const std::set<subdomain_id_type> & subdomains_relative_to);
 
+  /**
+   * Moves the nodes of a \p boundary_mesh created by \p sync() to the
+   * current locations of the corresponding nodes of the interior
+   * mesh.  When the interior mesh has only been displaced since the
+   * last \p sync(), this is much cheaper than extracting the boundary
+   * mesh again.  Neither mesh's elements may have changed since then.
+   */
+  void sync_points (MeshBase & boundary_mesh) const;
+
   /**
    * Suppose we have used sync to create \p boundary_mesh. Then each
    * element in \p boundary_mesh will have interior_parent defined.
@@ -146,7 +157,9 @@ public:
    *  - \p side_id_map stores a map from the element ids of the boundary mesh
    *    to the side index of the interior_parent that the boundary element
    *    corresponds to.
-   * \p tolerance is used to identify when we have matching elements.
+   * \p tolerance is used to identify when we have matching elements,
+   * unless \p boundary_mesh stores the parent side indices itself, as
+   * \p sync() does.
    */
   void get_side_and_node_maps (UnstructuredMesh & boundary_mesh,
                                std::map<dof_id_type, dof_id_type> & node_id_map,
@@ -770,6 +783,12 @@ public:
    */
   void print_summary (std::ostream & out=libMesh::out) const;
 
+  /**
+   * \returns The memory held on this processor by the boundary id
+   * maps, sets and names.
+   */
+  MemoryUsage memory_usage () const;
+
   /**
    * \returns A reference for getting an optional name for a sideset.
    */
@@ -860,16 +879,18 @@ private:
 
   /**
    * Data structure that maps nodes in the mesh
-   * to boundary ids.
+   * to boundary ids.  This and the maps below are kept in flat
+   * sorted vectors rather than std::multimaps, since there can be
+   * tens of millions of boundary entries and each query is a lookup.
    */
-  std::multimap<const Node *,
+  flat_multimap<const Node *,
                 boundary_id_type> _boundary_node_id;
 
   /**
    * Data structure that maps edges of elements
    * to boundary ids. This is only relevant in 3D.
    */
-  std::multimap<const Elem *,
+  flat_multimap<const Elem *,
                 std::pair<unsigned short int, boundary_id_type>>
   _boundary_edge_id;
 
@@ -877,7 +898,7 @@ private:
    * Data structure that maps faces of shell elements
    * to boundary ids. This is only relevant for shell elements.
    */
-  std::multimap<const Elem *,
+  flat_multimap<const Elem *,
                 std::pair<unsigned short int, boundary_id_type>>
   _boundary_shellface_id;
 
@@ -885,7 +906,7 @@ private:
    * Data structure that maps sides of elements
    * to boundary ids.
    */
-  std::multimap<const Elem *,
+  flat_multimap<const Elem *,
                 std::pair<unsigned short int, boundary_id_type>>
   _boundary_side_id;
 
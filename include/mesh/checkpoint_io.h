@@ -98,6 +98,14 @@ public:
    * running on several processors, input_name should simply be the name of the mesh split
    * directory without the "-split[n]" suffix.  The number of splits will be determined
    * automatically by the number of processes being used for the mesh at the time of reading.
+   *
+   * If there is no split for that many processes, the split with the
+   * fewest files no fewer than the number of processes is read, or
+   * failing that the split with the most files.  A DistributedMesh
+   * reads each file on only one processor, so no processor ever holds
+   * the whole mesh; when there are fewer files than processors, the
+   * partitioning in prepare_for_use() redistributes elements to the
+   * processors which read none.
    */
   virtual void read (const std::string & input_name) override;
 
@@ -166,6 +174,16 @@ public:
    */
   bool version_at_least_1_5() const;
 
+  /**
+   * \returns \p true if the current file has an XDR/XDA version that
+   * matches or exceeds 1.6
+   *
+   * As of this version the nodes and elements of each split file are
+   * stored as a few bulk arrays rather than value by value, so that
+   * each section can be read with a single call.
+   */
+  bool version_at_least_1_6() const;
+
   /**
    * Get/Set the processor id or processor ids to use.
    *
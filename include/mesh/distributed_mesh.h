@@ -99,6 +99,12 @@ public:
    */
   virtual void clear() override;
 
+  /**
+   * \returns The memory used by the mesh, including its node and
+   * element containers.
+   */
+  virtual MemoryUsage memory_usage () const override;
+
   /**
    * Redistribute elements between processors.  This gets called
    * automatically by the Partitioner, and is a no-op in the case of a
@@ -170,18 +176,35 @@ public:
   void libmesh_assert_valid_parallel_flags() const;
 
   /**
-   * Renumber a parallel objects container.
+   * Renumber a parallel objects container.  Objects with ids below
+   * \p first_new_id keep them; the rest are numbered contiguously
+   * from \p first_new_id, in blocks by processor id.
    *
    * \returns The smallest globally unused id for that container.
    */
   template <typename T>
-  dof_id_type renumber_dof_objects (mapvector<T *,dof_id_type> &);
+  dof_id_type renumber_dof_objects (mapvector<T *,dof_id_type> &,
+                                    dof_id_type first_new_id = 0);
 
   /**
    * Remove nullptr elements from arrays.
    */
   virtual void renumber_nodes_and_elements () override;
 
+  /**
+   * If \p new_only is true, renumber_nodes_and_elements() keeps the
+   * ids of nodes and elements numbered by its previous call, and only
+   * numbers objects added since then, after them.  This saves
+   * communicating and moving every object after each adaptive
+   * refinement step, but ids freed by deleted objects are left
+   * unused, so max_elem_id() may exceed n_elem().
+   */
+  void renumber_new_objects_only (bool new_only)
+  { _renumber_new_objects_only = new_only; }
+
+  bool renumber_new_objects_only () const
+  { return _renumber_new_objects_only; }
+
   /**
    * Gathers all elements and nodes of the mesh onto
    * every processor
@@ -583,6 +606,13 @@ protected:
   dof_id_type _next_free_unpartitioned_node_id,
     _next_free_unpartitioned_elem_id;
 
+  /**
+   * Whether renumber_nodes_and_elements() only numbers new objects,
+   * and the first ids it left unused on its previous call.
+   */
+  bool _renumber_new_objects_only;
+  dof_id_type _renumbered_node_id_end, _renumbered_elem_id_end;
+
 #ifdef LIBMESH_ENABLE_UNIQUE_ID
   /**
    * The next available unique id for assigning ids to unpartitioned DOF objects
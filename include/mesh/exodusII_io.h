@@ -27,6 +27,7 @@
 #include "libmesh/mesh_output.h"
 #include "libmesh/parallel_object.h"
 #include "libmesh/boundary_info.h" // BoundaryInfo::BCTuple
+#include "libmesh/bounding_box.h"
 #include "libmesh/exodus_header_info.h"
 
 namespace libMesh
@@ -77,6 +78,25 @@ public:
    */
   virtual void read (const std::string & name) override;
 
+  /**
+   * Reads the mesh in parallel: every processor reads a contiguous
+   * range of the file's elements, the coordinates of the nodes in a
+   * contiguous range, and the side and node sets, and the nodes each
+   * processor's elements need are exchanged among processors.  No
+   * processor ever holds the whole mesh.  The mesh is returned
+   * partitioned by those element ranges, with ghost elements
+   * gathered, and is repartitioned by its partitioner (e.g. a cheap
+   * \p SFCPartitioner) in \p prepare_for_use().
+   *
+   * Must be called on every processor.  Serial meshes, files with
+   * edge blocks, and reads with extra integer variables fall back on
+   * every processor calling \p read().  After a distributed read the
+   * element and node number maps held by the helper are only those
+   * of this processor's ranges, but copy_nodal_solution() and
+   * copy_elemental_solution() read their own ranges of the maps.
+   */
+  void read_distributed (const std::string & name);
+
   /**
    * Read only the header information, instead of the entire
    * mesh. After the header is read, the file is closed and the
@@ -132,6 +152,13 @@ public:
   /**
    * If we read in a nodal solution while reading in a mesh, we can attempt
    * to copy that nodal solution into an EquationSystems object.
+   *
+   * Must be called on every processor.  Each processor reads the
+   * values of a contiguous range of the file's nodes, which are then
+   * passed, by node id, to the processors owning those nodes and
+   * inserted into the solution all at once, so no processor ever
+   * holds the whole variable.  The file is opened for reading on
+   * every processor if processor 0 was the only one to open it.
    */
   void copy_nodal_solution(System & system,
                            std::string system_var_name,
@@ -141,6 +168,10 @@ public:
   /**
    * If we read in a elemental solution while reading in a mesh, we can attempt
    * to copy that elemental solution into an EquationSystems object.
+   *
+   * Like copy_nodal_solution(), this must be called on every
+   * processor, each of which reads a contiguous range of the file's
+   * elements.
    */
   void copy_elemental_solution(System & system,
                                std::string system_var_name,
@@ -268,6 +299,11 @@ public:
 
   /**
    * Writes out the solution at a specific timestep.
+   *
+   * Once the mesh has been written, later timesteps on an unchanged
+   * mesh only need the nodal values on processor 0, so a
+   * DistributedMesh is not serialized again to write them.
+   *
    * \param fname Name of the file to write to
    * \param es EquationSystems object which contains the solution vector.
    * \param timestep The timestep to write out, should be _1_ indexed.
@@ -350,6 +386,22 @@ public:
    */
   void set_extra_integer_vars(const std::vector<std::string> & extra_integer_vars);
 
+  /**
+   * Only read the elements of the blocks whose ids are in \p
+   * subdomain_ids, along with the nodes and boundary conditions they
+   * use; the connectivity of other blocks is never read, and unused
+   * nodes are never created.  An empty set, the default, reads every
+   * block.
+   */
+  void set_subdomains_to_read(const std::set<subdomain_id_type> & subdomain_ids);
+
+  /**
+   * Only read the elements with at least one node inside \p box,
+   * along with the nodes and boundary conditions they use.  This can
+   * be combined with set_subdomains_to_read().
+   */
+  void set_bounding_box_to_read(const BoundingBox & box);
+
   /**
    * Sets the list of variable names to be included in the output.
    * This is _optional_.  If this is never called then all variables
@@ -408,6 +460,24 @@ public:
    */
   void append(bool val);
 
+  /**
+   * If \p val is true, write_timestep() returns as soon as the
+   * solution has been gathered and copied, and processor 0 writes
+   * the nodal values and time of each timestep after the first in a
+   * background thread, overlapping the file I/O with the rest of the
+   * simulation.  Any other write through this object, and flush(),
+   * first waits for the pending write to finish.
+   *
+   * Without thread support the writes remain synchronous.
+   */
+  void set_asynchronous_write(bool val);
+
+  /**
+   * Waits for any asynchronous write started by write_timestep() to
+   * finish, and rethrows any error it encountered.
+   */
+  void flush();
+
   /**
    * Return list of the elemental variable names
    */
@@ -439,6 +509,53 @@ public:
                                bool continuous=true);
 
 private:
+#ifdef LIBMESH_HAVE_EXODUS_API
+  /**
+   * Adds the sides in the file's side sets to the mesh's
+   * BoundaryInfo, for those elements whose (zero-based) indices in
+   * the file are at least \p elem_begin and are covered by the
+   * helper's \p elem_num_map, which must start at \p elem_begin.
+   */
+  void read_sidesets(int elem_begin);
+
+  /**
+   * Opens the file which processor 0 has open for reading on every
+   * other processor which doesn't have it open already, so that all
+   * processors can read parts of it.
+   */
+  void open_for_reading_everywhere();
+
+  /**
+   * Sends the \p values read by each processor for the nodes (if
+   * \p nodal) or elements with (libMesh) ids \p ids to the
+   * processors owning those objects, and inserts them into variable
+   * \p var_num of the solution of \p system.
+   */
+  void insert_solution_values(System & system,
+                              unsigned int var_num,
+                              bool nodal,
+                              const std::vector<dof_id_type> & ids,
+                              const std::vector<Real> & values);
+
+  /**
+   * Writes nodal values for the current timestep, or queues them
+   * for the asynchronous write being prepared by write_timestep().
+   */
+  void write_nodal_values(int var_id, const std::vector<Real> & values);
+
+  /**
+   * \returns \p true if the file already holds this mesh's nodes,
+   * in which case nodal values can be written in the file's node
+   * order without a serialized mesh.  Must be called in parallel.
+   */
+  bool nodes_already_written();
+
+  /**
+   * The data and thread of an asynchronous timestep write.
+   */
+  struct AsyncWrite;
+#endif
+
   /**
    * Only attempt to instantiate an ExodusII helper class
    * if the Exodus API is defined.  This class will have no
@@ -463,6 +580,24 @@ private:
    * rather than created from scratch when writing.
    */
   bool _append;
+
+  /**
+   * Default false.  If true, write_timestep() leaves the file I/O
+   * to a background thread where it can.
+   */
+  bool _asynchronous_write;
+
+  /**
+   * The asynchronous write being prepared or running, if any.
+   */
+  std::unique_ptr<AsyncWrite> _async_write;
+
+  /**
+   * If true, write_nodal_data() orders its values by the node map
+   * already written to the file, rather than by iterating over a
+   * serialized mesh.
+   */
+  bool _use_file_node_order;
 #endif
 
   /**
@@ -472,6 +607,18 @@ private:
    */
   std::vector<std::string> _extra_integer_vars;
 
+  /**
+   * If not empty, only elements of these blocks are read.
+   */
+  std::set<subdomain_id_type> _subdomains_to_read;
+
+  /**
+   * If \p _read_bounding_box is true, only elements with a node in
+   * \p _bounding_box_to_read are read.
+   */
+  BoundingBox _bounding_box_to_read;
+  bool _read_bounding_box;
+
   /**
    * The names of the variables to be output.
    * If this is empty then all variables are output.
@@ -156,12 +156,24 @@ public:
    */
   void read_nodes();
 
+  /**
+   * Reads only the coordinates of the \p n_nodes nodes starting at
+   * (zero-based) index \p first_node into \p x, \p y and \p z.
+   */
+  void read_nodes(int first_node, int n_nodes);
+
   /**
    * Reads the optional \p node_num_map from the \p ExodusII mesh
    * file.
    */
   void read_node_num_map();
 
+  /**
+   * Reads only the entries of the \p node_num_map for the \p n_nodes
+   * nodes starting at (zero-based) index \p first_node.
+   */
+  void read_node_num_map(int first_node, int n_nodes);
+
   /**
    * Prints the nodal information, by default to \p libMesh::out.
    */
@@ -212,10 +224,22 @@ public:
    */
   void read_elem_in_block(int block);
 
+  /**
+   * Reads the connectivity of only those elements of block \p block
+   * whose (zero-based) indices in the file lie in [\p elem_begin,
+   * \p elem_end).  \p block_begin is the index of the first element of
+   * the block.  \p num_elem_this_blk is still set to the size of the
+   * whole block.
+   */
+  void read_elem_in_block(int block, int block_begin,
+                          int elem_begin, int elem_end);
+
   /**
    * Read in edge blocks, storing information in the BoundaryInfo object.
+   * If \p partial_mesh is true, edges which are not on any element of
+   * \p mesh are skipped rather than treated as errors.
    */
-  void read_edge_blocks(MeshBase & mesh);
+  void read_edge_blocks(MeshBase & mesh, bool partial_mesh = false);
 
   /**
    * Reads the optional \p node_num_map from the \p ExodusII mesh
@@ -223,6 +247,12 @@ public:
    */
   void read_elem_num_map();
 
+  /**
+   * Reads only the entries of the \p elem_num_map for the \p n_elem
+   * elements starting at (zero-based) index \p first_elem.
+   */
+  void read_elem_num_map(int first_elem, int n_elem);
+
   /**
    * Reads information about all of the sidesets in the \p ExodusII
    * mesh file.
@@ -283,6 +313,37 @@ public:
                                  int time_step,
                                  std::map<dof_id_type, Real> & elem_var_value_map);
 
+  /**
+   * Reads the values of nodal variable \p nodal_var_name at
+   * \p time_step for only the \p n_nodes nodes starting at
+   * (zero-based) index \p first_node, into \p values, and the
+   * (zero-based) libMesh ids of those nodes, from the node number
+   * map, into \p ids.  The node number map held by the helper is not
+   * touched.
+   */
+  void read_nodal_var_values(std::string nodal_var_name,
+                             int time_step,
+                             int first_node,
+                             int n_nodes,
+                             std::vector<dof_id_type> & ids,
+                             std::vector<Real> & values);
+
+  /**
+   * Reads the values of elemental variable \p elemental_var_name at
+   * \p time_step for only the \p n_elem elements starting at
+   * (zero-based) index \p first_elem, into \p values, and the
+   * (zero-based) libMesh ids of those elements into \p ids.
+   * Elements in blocks on which the variable is not defined are
+   * skipped.  The element number map held by the helper is not
+   * touched.
+   */
+  void read_elemental_var_values(std::string elemental_var_name,
+                                 int time_step,
+                                 int first_elem,
+                                 int n_elem,
+                                 std::vector<dof_id_type> & ids,
+                                 std::vector<Real> & values);
+
   /**
    * Opens an \p ExodusII mesh file named \p filename for writing.
    */
@@ -111,7 +111,9 @@ private:
 // medit_io inline members
 inline
 MEDITIO::MEDITIO (const MeshBase & mesh_in) :
-  MeshOutput<MeshBase> (mesh_in),
+  MeshOutput<MeshBase> (mesh_in,
+                        /* is_parallel_format = */ false,
+                        /* serial_only_needed_on_proc_0 = */ true),
   _binary (false),
   scalar_idx (0)
 {
@@ -119,7 +121,9 @@ MEDITIO::MEDITIO (const MeshBase & mesh_in) :
 
 inline
 MEDITIO::MEDITIO (const MeshBase & mesh_in, unsigned int c) :
-  MeshOutput<MeshBase> (mesh_in),
+  MeshOutput<MeshBase> (mesh_in,
+                        /* is_parallel_format = */ false,
+                        /* serial_only_needed_on_proc_0 = */ true),
   _binary    (false),
   scalar_idx (c)
 {
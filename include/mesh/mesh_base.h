@@ -44,6 +44,7 @@ enum ElemMappingType : unsigned char;
 #include <cstddef>
 #include <string>
 #include <memory>
+#include <vector>
 
 namespace libMesh
 {
@@ -55,10 +56,14 @@ class Node;
 class Point;
 class Partitioner;
 class BoundaryInfo;
+class MemoryUsage;
 
 template <class MT>
 class MeshInput;
 
+template <typename iterator_type, typename object_type>
+class StoredRange;
+
 
 /**
  * This is the \p MeshBase class. This class provides all the data necessary
@@ -1198,6 +1203,13 @@ public:
    */
   void print_info (std::ostream & os=libMesh::out) const;
 
+  /**
+   * \returns The memory held on this processor by the nodes,
+   * elements, containers and boundary information of the mesh.
+   * Derived classes add the memory held by their own containers.
+   */
+  virtual MemoryUsage memory_usage () const;
+
   /**
    * Equivalent to calling print_info() above, but now you can write:
    * Mesh mesh;
@@ -1295,10 +1307,114 @@ public:
   Real get_point_locator_close_to_point_tol() const;
 
   /**
-   * Releases the current \p PointLocator object.
+   * Set the type of PointLocator built by \p sub_point_locator().
+   * Defaults to \p TREE_ELEMENTS.  Changing the type releases the
+   * current master PointLocator, if any.
+   */
+  void set_point_locator_type (PointLocatorType type);
+  PointLocatorType get_point_locator_type () const;
+
+  /**
+   * Releases the current \p PointLocator object, along with any node
+   * to element index and cached element ranges, since the same mesh
+   * changes invalidate all of them.
    */
   void clear_point_locator ();
 
+  /**
+   * Builds an index from each node to the active elements containing
+   * it, stored in compressed row form, which find_point_neighbors()
+   * then uses in place of a search through element neighbor links.
+   * The index is released by clear_point_locator().  Building it is
+   * not thread-safe; ghosting functors which need it build it in
+   * their mesh_reinit().
+   */
+  void build_node_elem_index () const;
+
+  /**
+   * Releases the node to element index, if any.
+   */
+  void clear_node_elem_index ();
+
+  /**
+   * Fills \p neighbors with all active elements in the same manifold
+   * as the active element \p elem (including \p elem itself) which
+   * touch it at any point, sorted by address, as
+   * Elem::find_point_neighbors() would find them.
+   *
+   * With a node to element index this is a direct lookup, except near
+   * hanging nodes, where a shared node is not needed to touch and we
+   * fall back on Elem::find_point_neighbors().
+   */
+  void find_point_neighbors (const Elem & elem,
+                             std::vector<const Elem *> & neighbors) const;
+
+  /**
+   * \returns A \p ConstElemRange over the active local elements, for
+   * use with Threads::parallel_for() and parallel_reduce().  The
+   * element list is gathered on first use and then reused, without
+   * iterator filtering, until the mesh is next prepared, partitioned
+   * or redistributed; the range must not be used past such a change,
+   * nor reset().  Building the list is not thread-safe.
+   *
+   * \note Like the point locator, the list is only invalidated by
+   * prepare_for_use(), partitioning and parallel redistribution.
+   * Code which adds or removes elements by hand must prepare the mesh
+   * before using this.
+   */
+  StoredRange<const_element_iterator, const Elem *>
+  active_local_elem_range (const unsigned int grainsize = 1000) const;
+
+  /**
+   * \returns A \p ConstElemRange over the active local elements of
+   * subdomain \p sid, cached like active_local_elem_range().  Code
+   * which changes subdomain ids by hand must call clear_range_cache()
+   * afterwards.
+   */
+  StoredRange<const_element_iterator, const Elem *>
+  active_local_subdomain_elem_range (subdomain_id_type sid,
+                                     const unsigned int grainsize = 1000) const;
+
+  /**
+   * \returns A \p ConstNodeRange over the local nodes, cached like
+   * active_local_elem_range().
+   */
+  StoredRange<const_node_iterator, const Node *>
+  local_node_range (const unsigned int grainsize = 1000) const;
+
+  /**
+   * \returns The values of extra element integer \p index on the
+   * active local elements, in the order of active_local_elem_range(),
+   * so that hot loops can read e.g. a material id for every element
+   * from one contiguous array rather than from each element's own
+   * index buffer.  The value for the element at position \p p of the
+   * range, i.e. at \p std::distance(range.begin(), it) in a threaded
+   * loop over a subrange, is entry \p p.
+   *
+   * The values are gathered on first use and cached with the element
+   * list, so they follow the elements through refinement, partitioning
+   * and redistribution.  They are a snapshot, however: code which
+   * calls set_extra_integer() on local elements afterwards must call
+   * clear_range_cache().  Building the table is not thread-safe.
+   */
+  const std::vector<dof_id_type> &
+  active_local_elem_integers (const unsigned int index) const;
+
+  /**
+   * \returns The values of extra node integer \p index on the local
+   * nodes, in the order of local_node_range(), cached like
+   * active_local_elem_integers().
+   */
+  const std::vector<dof_id_type> &
+  local_node_integers (const unsigned int index) const;
+
+  /**
+   * Releases the element and node lists behind
+   * active_local_elem_range() and friends, along with any extra
+   * integer tables.
+   */
+  void clear_range_cache ();
+
   /**
    * In the point locator, do we count lower dimensional elements
    * when we refine point locator regions? This is relevant in
@@ -1734,6 +1850,21 @@ protected:
    */
   mutable std::unique_ptr<PointLocatorBase> _point_locator;
 
+  /**
+   * Node to active element adjacency built by
+   * build_node_elem_index(), or nullptr.  Mutable for the same
+   * reason as \p _point_locator.
+   */
+  struct NodeElemIndex;
+  mutable std::unique_ptr<NodeElemIndex> _node_elem_index;
+
+  /**
+   * Element and node lists behind active_local_elem_range() and
+   * friends, or nullptr.
+   */
+  struct RangeCache;
+  mutable std::unique_ptr<RangeCache> _range_cache;
+
   /**
    * Do we count lower dimensional elements in point locator refinement?
    * This is relevant in tree-based point locators, for example.
@@ -1877,6 +2008,11 @@ protected:
    */
   Real _point_locator_close_to_point_tol;
 
+  /**
+   * The type of PointLocator built by sub_point_locator()
+   */
+  PointLocatorType _point_locator_type;
+
   /**
    * The partitioner class is a friend so that it can set
    * the number of partitions.
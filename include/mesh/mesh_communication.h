@@ -95,6 +95,10 @@ public:
    * to satisfy data dependencies. This method can be invoked after a
    * partitioning step to affect the new partitioning.
    *
+   * Each processor is sent only the elements, and their nodes, which
+   * it does not already have, so a small repartitioning is cheap to
+   * redistribute.
+   *
    * Redistribution can also be done with newly coarsened elements'
    * neighbors only.
    */
@@ -163,6 +167,23 @@ public:
    */
   void assign_global_indices (MeshBase &) const;
 
+  /**
+   * This method renumbers the nodes and elements in the mesh so that
+   * each processor's objects remain a contiguous block of ids, but
+   * are ordered along the Hilbert space-filling curve within that
+   * block.  Objects which are close in space then tend to be close
+   * in memory order, and so do the degrees of freedom a DofMap
+   * later distributes on them, which improves cache reuse during
+   * assembly and reduces the bandwidth of the system matrix.
+   *
+   * Call this before EquationSystems::init(), or reinit() any
+   * systems afterward.  A later renumber_nodes_and_elements() may
+   * discard the node ordering unless allow_renumbering(false) is set.
+   *
+   * Does nothing if libMesh was configured without libHilbert.
+   */
+  void assign_local_hilbert_indices (MeshBase &) const;
+
   /**
    * Throw an error if we have any index clashes in the numbering used by
    * assign_global_indices.
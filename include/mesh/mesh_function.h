@@ -192,6 +192,53 @@ public:
                    DenseVector<Number> & output,
                    const std::set<subdomain_id_type> * subdomain_ids);
 
+  /**
+   * Computes values at each of the coordinates \p points and for time
+   * \p time, optionally restricting the points to the passed
+   * subdomain_ids.  The points are all located by one call to
+   * \p PointLocatorBase::locate_points(), which is much faster than
+   * locating them one at a time for large batches of nearby points.
+   */
+  void operator() (const std::vector<Point> & points,
+                   const Real time,
+                   std::vector<DenseVector<Number>> & outputs,
+                   const std::set<subdomain_id_type> * subdomain_ids = nullptr);
+
+  /**
+   * Computes the values of variable 0 at each of \p points, locating
+   * them all at once.
+   */
+  virtual void values (const std::vector<Point> & points,
+                       const Real time,
+                       std::vector<Number> & output) override;
+
+  /**
+   * Computes the values of variable \p i at each of \p points,
+   * locating them all at once.
+   */
+  virtual void component_values (unsigned int i,
+                                 const std::vector<Point> & points,
+                                 const Real time,
+                                 std::vector<Number> & output) override;
+
+  /**
+   * Computes values at each of the coordinates \p points and for time
+   * \p time, on a mesh and vector which need not be serialized.
+   * This must be called collectively; each processor may pass its own
+   * set of points.
+   *
+   * Each point is sent to the processors whose local elements have
+   * bounding boxes containing it, and evaluated by a processor which
+   * owns an element containing it, so the vector only needs to be
+   * ghosted like \p System::current_local_solution, and the mesh may
+   * be distributed.  Points found in no element get the out-of-mesh
+   * value, in out-of-mesh mode.
+   */
+  void evaluate_distributed (const std::vector<Point> & points,
+                             const Real time,
+                             std::vector<DenseVector<Number>> & outputs,
+                             const std::set<subdomain_id_type> * subdomain_ids = nullptr);
+
   /**
    * Similar to operator() with the same parameter list, but with the difference
    * that multiple values on faces are explicitly permitted. This is useful for
@@ -222,6 +269,18 @@ public:
                  std::vector<Gradient> & output,
                  const std::set<subdomain_id_type> * subdomain_ids = nullptr);
 
+  /**
+   * Computes gradients at each of the coordinates \p points and for
+   * time \p time, optionally restricting the points to the passed
+   * subdomain_ids.  Points which are found in no element get an empty
+   * gradient vector.  The points are located as in the batched
+   * \p operator().
+   */
+  void gradient (const std::vector<Point> & points,
+                 const Real time,
+                 std::vector<std::vector<Gradient>> & outputs,
+                 const std::set<subdomain_id_type> * subdomain_ids = nullptr);
+
   /**
    * Similar to gradient, but with the difference
    * that multiple values on faces are explicitly permitted. This is useful for
@@ -310,6 +369,38 @@ protected:
   const Elem * find_element(const Point & p,
                             const std::set<subdomain_id_type> * subdomain_ids = nullptr) const;
 
+  /**
+   * Locates each of \p points, as \p find_element() does, filling
+   * \p elements with the results.
+   */
+  void find_elements(const std::vector<Point> & points,
+                     std::vector<const Elem *> & elements,
+                     const std::set<subdomain_id_type> * subdomain_ids = nullptr) const;
+
+  /**
+   * \returns \p element, or if our vector cannot be read there, a
+   * local element sharing the point \p p, or \p nullptr if there is
+   * none.
+   */
+  const Elem * usable_element(const Elem * element,
+                              const Point & p) const;
+
+  /**
+   * Computes the values of our variables at \p p, which must be in
+   * \p element.
+   */
+  void compute_values (const Elem * element,
+                       const Point & p,
+                       DenseVector<Number> & output) const;
+
+  /**
+   * Computes the gradients of our variables at \p p, which must be
+   * in \p element.
+   */
+  void compute_gradients (const Elem * element,
+                          const Point & p,
+                          std::vector<Gradient> & output) const;
+
   /**
    * \returns All elements that are close to a point \p p.
    *
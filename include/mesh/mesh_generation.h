@@ -76,6 +76,27 @@ void build_cube (UnstructuredMesh & mesh,
                  const ElemType type=INVALID_ELEM,
                  const bool gauss_lobatto_grid=false);
 
+/**
+ * Builds the same \f$ nx \times ny \times nz \f$ HEX8 cube as
+ * \p build_cube(), but on a distributed \p mesh each processor only
+ * ever creates the elements in its own block of a structured
+ * partition, along with the layer of elements touching that block.
+ * Processors are arranged in a grid chosen to minimize the surface
+ * between blocks, and ids, unique ids and processor ids are all
+ * computed arithmetically, so no processor ever holds the whole mesh
+ * and no partitioner runs.  The structured partition is kept until
+ * the mesh is next repartitioned.
+ *
+ * On a replicated \p mesh this simply calls \p build_cube().
+ */
+void build_distributed_cube (UnstructuredMesh & mesh,
+                             const unsigned int nx,
+                             const unsigned int ny,
+                             const unsigned int nz,
+                             const Real xmin=0., const Real xmax=1.,
+                             const Real ymin=0., const Real ymax=1.,
+                             const Real zmin=0., const Real zmax=1.);
+
 /**
  * A specialized \p build_cube() for 0D meshes.  The resulting
  * mesh is a single NodeElem suitable for ODE tests
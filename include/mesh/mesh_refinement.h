@@ -33,6 +33,7 @@
 #include "libmesh/parallel_object.h"
 
 // C++ Includes
+#include <map>
 #include <vector>
 
 namespace libMesh
@@ -543,6 +544,10 @@ private:
    * possible that for a given set of refinement flags there is
    * actually no change upon calling this member function.
    *
+   * The smoothing passes and the ghost flag exchange are repeated as
+   * a single sweep, which needs only neighbor communication plus one
+   * global reduction to detect that no processor changed any flag.
+   *
    * \returns \p true if the flags actually changed (hence data needs
    * to be projected) and \p false otherwise.
    */
@@ -709,6 +714,20 @@ private:
    */
   void update_nodes_map ();
 
+  /**
+   * The parent node, or else the bracketing parent nodes and the
+   * location, of one node of a child to be built by Elem::refine().
+   */
+  struct ChildNodeData;
+
+  /**
+   * Fills \p data with the ChildNodeData of every node of every child
+   * of \p parent, child by child.  This does not modify the mesh, so
+   * it can be run on many parents at once in separate threads.
+   */
+  void compute_child_node_data (const Elem & parent,
+                                std::vector<ChildNodeData> & data) const;
+
   /**
    * Take user-specified coarsening flags and augment them
    * so that level-one dependency is satisfied.
@@ -748,6 +767,13 @@ private:
    */
   TopologyMap _new_nodes_map;
 
+  /**
+   * While _refine_elements() has each Elem refine itself, the
+   * precomputed ChildNodeData for that Elem, if any, which add_node()
+   * then uses instead of recomputing it.
+   */
+  const std::vector<ChildNodeData> * _child_node_data;
+
   /**
    * Reference to the mesh.
    */
@@ -855,6 +881,22 @@ private:
    */
   bool _enforce_mismatch_limit_prior_to_refinement;
 
+  /**
+   * Set while _smooth_flags() runs its passes.  Each flag consistency
+   * and smoothing pass then returns whether it changed flags on this
+   * processor only, and _smooth_flags() does one global reduction per
+   * sweep instead of one per pass.
+   */
+  bool _defer_smoothing_reductions;
+
+  /**
+   * The ids of our ghost elements, sorted by owning processor.
+   * _smooth_flags() builds these once, since its passes never change
+   * the ghosting, and make_flags_parallel_consistent() reuses them for
+   * the exchange in every sweep.
+   */
+  std::map<processor_id_type, std::vector<dof_id_type>> _flag_sync_requests;
+
   /**
    * This helper function enforces the desired mismatch limits prior
    * to refinement.  It is called from the
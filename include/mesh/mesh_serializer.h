@@ -20,9 +20,10 @@
 #define LIBMESH_MESH_SERIALIZER_H
 
 // Local includes
+#include "libmesh/id_types.h"
 
 // C++ includes
-
+#include <functional>
 
 namespace libMesh
 {
@@ -35,6 +36,16 @@ class MeshBase;
  * need_serial is true, then remote elements are deleted again by the
  * destructor.
  *
+ * If \p serial_only_needed_on_proc_0 is true, the mesh is only
+ * gathered onto processor 0.  By default processor 0 then keeps the
+ * whole mesh, so that later serializations are free; if
+ * \p keep_serial_on_proc_0 is false, the destructor deletes its
+ * remote elements again instead.
+ *
+ * Writers which can handle a mesh one piece at a time should use
+ * stream_to_zero() instead, so that no processor ever holds the
+ * whole mesh.
+ *
  * \author Roy Stogner
  * \date 2011
  * \brief Temporarily serializes a DistributedMesh for output.
@@ -42,10 +53,32 @@ class MeshBase;
 class MeshSerializer
 {
 public:
-  MeshSerializer(MeshBase & mesh, bool need_serial = true, bool serial_only_needed_on_proc_0 = false);
+  MeshSerializer(MeshBase & mesh, bool need_serial = true, bool serial_only_needed_on_proc_0 = false,
+                 bool keep_serial_on_proc_0 = true);
 
   ~MeshSerializer();
 
+  /**
+   * Calls \p visit on processor 0 once for each processor \p pid,
+   * in order, with a mesh containing every element (with its
+   * ancestors and nodes) that \p pid has, including all of the
+   * elements \p pid owns.  For \p pid 0 that is \p mesh itself;
+   * for the others it is a scratch mesh, which is cleared before the
+   * next processor's elements arrive, so that processor 0 only ever
+   * holds its own part of the mesh plus one other processor's part.
+   *
+   * The visited meshes also contain ghost elements, and the scratch
+   * meshes have no neighbor links, so \p visit should only consider
+   * elements with processor_id() \p pid, and only their nodes.
+   *
+   * This must be called on all processors at once.  It does nothing
+   * to the mesh itself, and if the mesh is already serial on
+   * processor 0, every visit is to \p mesh itself.
+   */
+  static void
+  stream_to_zero(MeshBase & mesh,
+                 const std::function<void (const MeshBase &, processor_id_type)> & visit);
+
 private:
   MeshBase & _mesh;
   bool reparallelize;
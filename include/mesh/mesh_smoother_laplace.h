@@ -21,6 +21,7 @@
 #define LIBMESH_MESH_SMOOTHER_LAPLACE_H
 
 // C++ Includes
+#include <map>
 #include <vector>
 
 // Local Includes
@@ -38,6 +39,10 @@ namespace libMesh
  * guarantee that points will be smoothed to valid locations, e.g.
  * locations inside the boundary!  This aspect could use work.
  *
+ * Each iteration is a Jacobi one, threaded over the nodes this
+ * processor owns, followed by a single exchange of the new positions
+ * with the processors which have those nodes as ghosts.
+ *
  * \author John W. Peterson
  * \date 2002-2007
  */
@@ -77,6 +82,10 @@ public:
    * which is expensive.  It's provided separately from
    * the constructor since you may or may not want
    * to build the L-graph on construction.
+   *
+   * The graph is only built for the nodes this processor owns, from
+   * the local and ghost elements, and is kept until init() is called
+   * again, so call it again if the mesh is modified.
    */
   void init();
 
@@ -88,10 +97,16 @@ public:
 
 private:
   /**
-   * This function allgather's the (local) graph after
-   * it is computed on each processor by the init() function.
+   * Finds which processors need the positions of which of our nodes,
+   * and which of our ghost nodes each processor will send us.
+   */
+  void build_ghost_lists();
+
+  /**
+   * Sends the positions of our nodes to the processors which have
+   * them as ghosts.
    */
-  void allgather_graph();
+  void sync_ghost_positions();
 
   /**
    * True if the L-graph has been created, false otherwise.
@@ -99,9 +114,22 @@ private:
   bool _initialized;
 
   /**
-   * Data structure for holding the L-graph
+   * The L-graph for the vertices this processor owns, in compressed
+   * row form: the neighbors of node \p _graph_nodes[i] are
+   * \p _graph_neighbors[_graph_offsets[i]] up to
+   * \p _graph_neighbors[_graph_offsets[i+1]].
+   */
+  std::vector<dof_id_type> _graph_nodes;
+  std::vector<dof_id_type> _graph_offsets;
+  std::vector<dof_id_type> _graph_neighbors;
+
+  /**
+   * The ids of our nodes which each other processor has as ghosts,
+   * and of the ghost nodes each other processor owns, in the order
+   * their positions are exchanged.
    */
-  std::vector<std::vector<dof_id_type>> _graph;
+  std::map<processor_id_type, std::vector<dof_id_type>> _ghost_send_nodes;
+  std::map<processor_id_type, std::vector<dof_id_type>> _ghost_recv_nodes;
 };
 
 
@@ -31,6 +31,7 @@
 #include <cstddef>
 #include <vector>
 #include <map>
+#include <unordered_map>
 #include <fstream>
 
 namespace libMesh
@@ -57,6 +58,13 @@ class UnstructuredMesh;
  * 3) L. Branets, "A variational grid optimization algorithm based on a local
  * cell quality metric", Ph.D. thesis, The University of Texas at Austin, 2005.
  *
+ * The evaluation of the functional, its gradient and its Hessian is
+ * threaded over cells.  On a distributed mesh each processor moves
+ * only the nodes it owns, holding ghost nodes fixed, so that each
+ * Newton direction is a block Jacobi one; directions are then
+ * exchanged for ghost nodes and the step length is chosen by a line
+ * search over the functional summed over every processor.
+ *
  * \author Derek R. Gaston
  * \date 2006
  */
@@ -207,10 +215,24 @@ private:
   dof_id_type _n_hanging_edges;
 
   /**
-   * All output (including debugging) is sent to the _logfile.
+   * All output (including debugging) is sent to the _logfile, on
+   * processor 0 only.
    */
   std::ofstream _logfile;
 
+  /**
+   * The index into the smoother's node arrays of each node in the
+   * Mesh, in the order the nodes are iterated over.
+   */
+  std::unordered_map<dof_id_type, dof_id_type> _node_index;
+
+  /**
+   * The target metric generated from the mesh, with the \p _dim by
+   * \p _dim matrix for each cell stored contiguously, kept for
+   * smoothing calls which don't generate it anew.
+   */
+  std::vector<Real> _target_metric;
+
   /**
    * Area of Interest Mesh
    */
@@ -267,9 +289,6 @@ private:
              std::vector<int> & edges,
              std::vector<int> & hnodes);
 
-  int readmetr(std::string name,
-               Array3D<Real> & H);
-
   int read_adp(std::vector<Real> & afun);
 
   Real jac3(Real x1, Real y1, Real z1,
@@ -303,7 +322,7 @@ private:
                    int adp,
                    int gr);
 
-  Real maxE(Array2D<Real> & R,
+  Real maxE(const Array2D<Real> & R,
             const Array2D<int> & cells,
             const std::vector<int> & mcells,
             int me,
@@ -359,7 +378,7 @@ private:
 
   Real localP(Array3D<Real> & W,
               Array2D<Real> & F,
-              Array2D<Real> & R,
+              const Array2D<Real> & R,
               const std::vector<int> & cell_in,
               const std::vector<int> & mask,
               Real epsilon,
@@ -399,8 +418,42 @@ private:
               const std::vector<Real> & g,
               Real sigma);
 
-  void metr_data_gen(std::string grid,
-                     std::string metr,
+  /**
+   * Evaluates the functional at the node positions \p R, summed over
+   * the cells owned by this processor and then over every processor,
+   * along with the global minimum cell volume \p Vmin, maximum cell
+   * functional \p emax and minimum cell quality \p qmin.
+   */
+  Real functional(const Array2D<Real> & R,
+                  const std::vector<int> & mask,
+                  const Array2D<int> & cells,
+                  const std::vector<int> & mcells,
+                  Real epsilon,
+                  Real w,
+                  int me,
+                  const Array3D<Real> & H,
+                  Real vol,
+                  int adp,
+                  const std::vector<Real> & afun,
+                  Array2D<Real> & G,
+                  Real & Vmin,
+                  Real & emax,
+                  Real & qmin);
+
+  /**
+   * Copies the rows of \p X for the nodes owned by this processor to
+   * the processors which have them as ghost nodes.
+   */
+  void sync_ghost_nodes(Array2D<Real> & X);
+
+  /**
+   * Generates the target metric \p H for metric type \p me from the
+   * node positions \p R.
+   */
+  void metr_data_gen(const Array2D<Real> & R,
+                     const Array2D<int> & cells,
+                     const std::vector<int> & mcells,
+                     Array3D<Real> & H,
                      int me);
 
   int solver(int n,
@@ -24,6 +24,7 @@
 
 
 // Local includes
+#include "libmesh/id_types.h"
 #include "libmesh/mesh_serializer.h"
 #include "libmesh/point.h" // used for specifying holes
 
@@ -31,6 +32,7 @@
 #include <cstddef>
 #include <map>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace libMesh
@@ -39,6 +41,7 @@ namespace libMesh
 class UnstructuredMesh;
 class TetGenWrapper;
 class Elem;
+class Node;
 
 /**
  * Class \p TetGenMeshInterface provides an interface for
@@ -112,11 +115,23 @@ protected:
   void fill_pointlist(TetGenWrapper & wrapper);
 
   /**
-   * Assigns the node IDs contained in the 'node_labels'
-   * array to 'elem'.
+   * Assigns the nodes with the TetGen (sequential) indices contained
+   * in the 'node_labels' array to 'elem'.
    */
   void assign_nodes_to_elem(unsigned * node_labels, Elem * elem);
 
+  /**
+   * Adds the output points of \p wrapper beyond those we gave it to
+   * the mesh, as new nodes.
+   */
+  void add_output_nodes(TetGenWrapper & wrapper);
+
+  /**
+   * Adds all the tetrahedra in the output of \p wrapper to the mesh,
+   * after reserving space for them.
+   */
+  void add_tetrahedra(TetGenWrapper & wrapper);
+
   /**
    * This function checks the integrity of the current set of
    * elements in the Mesh to see if they comprise a convex hull,
@@ -155,9 +170,12 @@ protected:
    * This is not the default behavior of DistributedMesh, for example,
    * unless you specify node IDs explicitly.  So this array allows us
    * to keep a mapping between the sequential numbering in
-   * tetgen_data.pointlist.
+   * tetgen_data.pointlist and the libMesh nodes, and the map below
+   * allows us to go the other way without searching.
    */
-  std::vector<unsigned> _sequential_to_libmesh_node_map;
+  std::vector<Node *> _sequential_to_libmesh_node_map;
+
+  std::unordered_map<dof_id_type, int> _libmesh_to_sequential_node_map;
 
   /**
    * Tetgen only operates on serial meshes.
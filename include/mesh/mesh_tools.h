@@ -30,9 +30,11 @@
 namespace libMesh
 {
 enum ElemType : int;
+enum ElemQuality : int;
 }
 #else
 #include "libmesh/enum_elem_type.h"
+#include "libmesh/enum_elem_quality.h"
 #endif
 
 // C++ Includes
@@ -327,6 +329,49 @@ dof_id_type n_nodes (const MeshBase::const_node_iterator & begin,
  */
 unsigned int max_level (const MeshBase & mesh);
 
+/**
+ * Summary statistics of one element quality metric over the active
+ * elements of a mesh.
+ */
+struct QualityStatistics
+{
+  /**
+   * The metric, and its minimum, maximum and mean over all active
+   * elements.
+   */
+  ElemQuality metric;
+  Real min;
+  Real max;
+  Real mean;
+
+  /**
+   * The number of active elements.
+   */
+  dof_id_type n_elem;
+
+  /**
+   * The number of elements whose value falls in each of the
+   * equal width bins which divide [min, max].  When all values are
+   * equal there is a single bin.
+   */
+  std::vector<unsigned int> histogram;
+};
+
+/**
+ * Computes the statistics of each of the quality \p metrics over all
+ * active elements of \p mesh, with histograms of \p n_bins bins.
+ *
+ * Each processor evaluates every metric for its local elements in a
+ * single threaded pass, using Elem::qualities() so that element types
+ * can share work between metrics, and the histograms are summed with
+ * a Parallel::Histogram.  This function must be run on all
+ * processors at once.
+ */
+std::vector<QualityStatistics>
+quality_statistics (const MeshBase & mesh,
+                    const std::vector<ElemQuality> & metrics,
+                    const unsigned int n_bins = 10);
+
 /**
  * Given a mesh and a node in the mesh, the vector will be filled with
  * every node directly attached to the given one.
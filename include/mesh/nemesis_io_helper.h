@@ -671,6 +671,10 @@ private:
    * This function constructs the set of border node IDs present
    * on the current mesh.  These are nodes which live on the "border"
    * between elements which live on different processors.
+   *
+   * Each processor sends the nodes it touches to their owners and
+   * hears back which other processors touch them, so only nodes on
+   * processor interfaces are communicated.
    */
   void compute_border_node_ids(const MeshBase & pmesh);
 
@@ -75,8 +75,7 @@ public:
                                  const std::vector<std::string> &) override;
 
   /**
-   * Flag indicating whether or not to write a binary file
-   * (if the tecio.a library was found by \p configure).
+   * Flag indicating whether or not to write a binary file.
    */
   bool & binary ();
 
@@ -120,14 +119,27 @@ private:
   /**
    * This method implements writing a mesh with nodal data to a
    * specified file where the nodal data and variable names are optionally
-   * provided.  This will write a binary file if the tecio.a library was
-   * found at compile time, otherwise a warning message will be printed and
-   * an ASCII file will be created.
+   * provided.  This will write a binary file with the tecio.a library if it
+   * was found at compile time, otherwise with write_plt().
    */
   void write_binary (const std::string &,
                      const std::vector<Number> * = nullptr,
                      const std::vector<std::string> * = nullptr);
 
+  /**
+   * Writes a binary (.plt, version 112) file without the Tecplot
+   * API: one finite element zone per subdomain, with the nodal data
+   * stored once in the first zone and shared by the others.
+   */
+  void write_plt (const std::string &,
+                  const std::vector<Number> * = nullptr,
+                  const std::vector<std::string> * = nullptr);
+
+  /**
+   * \returns The name of the zone for subdomain \p sbd_id.
+   */
+  std::string subdomain_zone_name (subdomain_id_type sbd_id) const;
+
   /**
    * Determines the logical spatial dimension of the elements in the
    * Mesh.  Ex: A 1D edge element living in 3D is a logically
@@ -61,7 +61,9 @@ public:
   explicit
   UCDIO (MeshBase & mesh) :
     MeshInput<MeshBase> (mesh),
-    MeshOutput<MeshBase>(mesh)
+    MeshOutput<MeshBase> (mesh,
+                          /* is_parallel_format = */ false,
+                          /* serial_only_needed_on_proc_0 = */ true)
   {}
 
   /**
@@ -70,7 +72,9 @@ public:
    */
   explicit
   UCDIO (const MeshBase & mesh) :
-    MeshOutput<MeshBase> (mesh)
+    MeshOutput<MeshBase> (mesh,
+                          /* is_parallel_format = */ false,
+                          /* serial_only_needed_on_proc_0 = */ true)
   {}
 
   /**
@@ -144,7 +144,9 @@ public:
   /**
    * Constructs a mesh called "new_mesh" from the current mesh by
    * iterating over the elements between it and it_end and adding
-   * them to the new mesh.
+   * them to the new mesh.  The new mesh keeps the partitioning of
+   * this mesh, and is distributed if this mesh is; each processor
+   * only needs to pass the elements it has.
    */
   void create_submesh (UnstructuredMesh & new_mesh,
                        const const_element_iterator & it,
@@ -29,12 +29,14 @@
 #include <cstddef>
 #include <map>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace libMesh
 {
 
 // Forward declarations
+class AsciiTokenizer;
 class MeshBase;
 
 /**
@@ -126,7 +128,7 @@ private:
   /**
    * Read nodes from file.
    */
-  void nodes_in (std::istream & in_file);
+  void nodes_in (AsciiTokenizer & in_file);
 
   /**
    * Method reads elements and stores them in
@@ -134,13 +136,13 @@ private:
    * come in. Within \p UNVIO, element labels are
    * ignored.
    */
-  void elements_in (std::istream & in_file);
+  void elements_in (AsciiTokenizer & in_file);
 
   /**
    * Reads the "groups" section of the file. The format of the groups section is described here:
    * http://www.sdrl.uc.edu/universal-file-formats-for-modal-analysis-testing-1/file-format-storehouse/unv_2467.htm
    */
-  void groups_in(std::istream & in_file);
+  void groups_in(AsciiTokenizer & in_file);
 
   //-------------------------------------------------------------
   // write support methods
@@ -185,7 +187,7 @@ private:
    * Maps UNV node IDs to libMesh Node*s. Used when reading. Even if the
    * libMesh Mesh is renumbered, this map should continue to be valid.
    */
-  std::map<dof_id_type, Node *> _unv_node_id_to_libmesh_node_ptr;
+  std::unordered_map<dof_id_type, Node *> _unv_node_id_to_libmesh_node_ptr;
 
   /**
    * label for the node dataset
@@ -205,7 +207,7 @@ private:
   /**
    * Map UNV element IDs to libmesh element IDs.
    */
-  std::map<unsigned, unsigned> _unv_elem_id_to_libmesh_elem_id;
+  std::unordered_map<unsigned, unsigned> _unv_elem_id_to_libmesh_elem_id;
 
   /**
    * Map from libMesh Node* to data at that node, as read in by the
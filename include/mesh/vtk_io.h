@@ -36,6 +36,7 @@
 // C++ includes
 #include <cstddef>
 #include <map>
+#include <vector>
 
 // Forward declarations
 class vtkUnstructuredGrid;
@@ -50,8 +51,13 @@ class MeshBase;
  * Format description:
  * cf. <a href="http://www.vtk.org/">VTK home page</a>.
  *
- * This class will not have any functionality unless VTK is detected
- * during configure and hence LIBMESH_HAVE_VTK is defined.
+ * Reading requires VTK to be detected during configure, so that
+ * LIBMESH_HAVE_VTK is defined.  Without VTK, and for parallel
+ * solution vectors in any case, files are written by a native VTK
+ * XML writer: each processor writes its active local elements, and
+ * the nodes they use, to a "name_<pid>.vtu" piece with appended
+ * binary data, and processor 0 writes the .pvtu file listing the
+ * pieces.  Nothing is gathered onto a single processor.
  *
  * \author Wout Ruijter
  * \author John W. Peterson
@@ -93,6 +99,18 @@ public:
                                  const std::vector<Number> &,
                                  const std::vector<std::string> &) override;
 
+  /**
+   * This method implements writing a mesh with nodal data from a
+   * parallel, node-major solution vector, as built by
+   * EquationSystems::build_parallel_solution_vector().  Each processor
+   * localizes only the values on the nodes of its own piece.
+   *
+   * This always uses the native VTK XML writer.
+   */
+  virtual void write_nodal_data (const std::string &,
+                                 const NumericVector<Number> &,
+                                 const std::vector<std::string> &) override;
+
   /**
    * This method implements reading a mesh from a specified file
    * in VTK format.
@@ -112,13 +130,14 @@ public:
    */
   virtual void write (const std::string &) override;
 
-#ifdef LIBMESH_HAVE_VTK
-
   /**
-   * Setter for compression flag
+   * Setter for compression flag.  The native writer compresses with
+   * zlib, when it is available.
    */
   void set_compression(bool b);
 
+#ifdef LIBMESH_HAVE_VTK
+
   /**
    * Get a pointer to the VTK unstructured grid data structure.
    */
@@ -168,11 +187,6 @@ private:
    */
   vtkSmartPointer<vtkUnstructuredGrid> _vtk_grid;
 
-  /**
-   * Flag to indicate whether the output should be compressed
-   */
-  bool _compress;
-
   /**
    * maps global node id to node id of partition
    */
@@ -220,6 +234,28 @@ private:
   static ElementMaps build_element_maps();
 
 #endif
+
+private:
+  /**
+   * \returns The sorted ids of the nodes of the active local
+   * elements, which the native writer puts in this processor's piece.
+   */
+  std::vector<dof_id_type> piece_nodes () const;
+
+  /**
+   * Write this processor's piece, and on processor 0 the .pvtu file,
+   * with the native writer.  \p piece_soln holds the values of each
+   * variable in \p names on each node of \p nodes, node by node.
+   */
+  void write_native (const std::string & fname,
+                     const std::vector<dof_id_type> & nodes,
+                     const std::vector<Number> & piece_soln,
+                     const std::vector<std::string> & names);
+
+  /**
+   * Flag to indicate whether the output should be compressed
+   */
+  bool _compress;
 };
 
 
@@ -94,6 +94,10 @@ public:
 
   /**
    * This method implements writing a mesh to a specified file.
+   *
+   * Uncompressed binary files written in parallel hold one chunk per
+   * processor, which all processors write at once; other parallel
+   * files are serialized through processor 0.
    */
   virtual void write (const std::string &) override;
 
@@ -201,6 +205,16 @@ public:
    */
   bool version_at_least_1_3_0() const;
 
+  /**
+   * \returns \p true if the current file has an XDR/XDA version that
+   * matches or exceeds 1.4.0.
+   *
+   * In this version binary parallel files hold one chunk of mesh data
+   * per writing processor, at offsets given by an index at the end of
+   * the file.
+   */
+  bool version_at_least_1_4_0() const;
+
 private:
 
 
@@ -254,6 +268,16 @@ private:
    */
   void write_serialized_bc_names (Xdr & io, const BoundaryInfo & info, bool is_sideset) const;
 
+  /**
+   * Write this processor's part of the mesh, with the elements,
+   * nodes and boundary conditions it would keep if remote elements
+   * were deleted, as one chunk of a binary parallel file.  The header
+   * must already have been written and closed.  Chunk offsets come
+   * from a gather of the chunk sizes, so every processor writes its
+   * chunk at the same time.  NEW in 1.4.0 format.
+   */
+  void write_chunks (const std::string & name) const;
+
 
   //---------------------------------------------------------------------------
   // Read Implementation
@@ -323,6 +347,13 @@ private:
    */
   void read_serialized_bc_names(Xdr & io, BoundaryInfo & info, bool is_sideset);
 
+  /**
+   * Read the chunks of a binary parallel file.  A distributed mesh
+   * read with as many processors as wrote the file reads only its own
+   * chunk; otherwise every chunk is read.  NEW in 1.4.0 format.
+   */
+  void read_chunks (const std::string & name);
+
   //-------------------------------------------------------------------------
   /**
    * Pack an element into a transfer buffer for parallel communication.
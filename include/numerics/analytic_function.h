@@ -22,6 +22,7 @@
 
 // Local Includes
 #include "libmesh/function_base.h"
+#include "libmesh/int_range.h"
 
 // C++ includes
 #include <cstddef>
@@ -100,6 +101,15 @@ public:
   virtual void operator() (const Point & p,
                            const Real time,
                            DenseVector<Output> & output) override;
+
+  virtual void values (const std::vector<Point> & points,
+                       const Real time,
+                       std::vector<Output> & output) override;
+
+  virtual void component_values (unsigned int i,
+                                 const std::vector<Point> & points,
+                                 const Real time,
+                                 std::vector<Output> & output) override;
 };
 
 
@@ -130,6 +140,50 @@ void AnalyticFunction<Output>::operator() (const Point & p,
 
 
 
+template <typename Output>
+inline
+void AnalyticFunction<Output>::values (const std::vector<Point> & points,
+                                       const Real time,
+                                       std::vector<Output> & output)
+{
+  libmesh_assert (this->initialized());
+  libmesh_assert (this->_number_fptr);
+
+  output.resize(points.size());
+  for (auto i : index_range(points))
+    output[i] = this->_number_fptr(points[i], time);
+}
+
+
+
+template <typename Output>
+inline
+void AnalyticFunction<Output>::component_values (unsigned int i,
+                                                 const std::vector<Point> & points,
+                                                 const Real time,
+                                                 std::vector<Output> & output)
+{
+  libmesh_assert (this->initialized());
+
+  if (!this->_vector_fptr)
+    {
+      libmesh_assert_equal_to (i, 0);
+      this->values(points, time, output);
+      return;
+    }
+
+  // Reuse one vector for the whole batch
+  output.resize(points.size());
+  DenseVector<Output> outvec(i+1);
+  for (auto j : index_range(points))
+    {
+      this->_vector_fptr(outvec, points[j], time);
+      output[j] = outvec(i);
+    }
+}
+
+
+
 template <typename Output>
 AnalyticFunction<Output>::AnalyticFunction (OutputFunction fptr) :
   FunctionBase<Output> (),
@@ -166,6 +166,30 @@ public:
       component(reverse_index_map[i].second,p,time);
   }
 
+  virtual void values(const std::vector<Point> & points,
+                      const Real time,
+                      std::vector<Output> & output) override
+  {
+    this->component_values(0, points, time, output);
+  }
+
+  virtual void component_values(unsigned int i,
+                                const std::vector<Point> & points,
+                                const Real time,
+                                std::vector<Output> & output) override
+  {
+    if (i >= reverse_index_map.size() ||
+        reverse_index_map[i].first == libMesh::invalid_uint)
+      {
+        output.assign(points.size(), 0);
+        return;
+      }
+
+    // Hand the whole batch to the subfunction at once
+    subfunctions[reverse_index_map[i].first]->
+      component_values(reverse_index_map[i].second, points, time, output);
+  }
+
   virtual std::unique_ptr<FunctionBase<Output>> clone() const override
   {
     CompositeFunction * returnval = new CompositeFunction();
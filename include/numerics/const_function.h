@@ -72,6 +72,17 @@ public:
       output(i) = _c;
   }
 
+  virtual void values(const std::vector<Point> & points,
+                      const Real,
+                      std::vector<Output> & output) override
+  { output.assign(points.size(), _c); }
+
+  virtual void component_values(unsigned int,
+                                const std::vector<Point> & points,
+                                const Real,
+                                std::vector<Output> & output) override
+  { output.assign(points.size(), _c); }
+
   virtual std::unique_ptr<FunctionBase<Output>> clone() const override
   {
     return libmesh_make_unique<ConstFunction<Output>>(_c);
@@ -22,10 +22,13 @@
 
 // Local Includes
 #include "libmesh/libmesh_common.h"
+#include "libmesh/simple_range.h"
 
 // C++ includes
 #include <algorithm>
+#include <atomic>
 #include <limits>
+#include <mutex>
 #include <utility> // std::pair
 #include <vector>
 
@@ -61,6 +64,13 @@ public:
   explicit
   CouplingMatrix (const unsigned int n=0);
 
+  /**
+   * Copying copies the coupling pattern but not the cached row
+   * indices, which the copy rebuilds when it needs them.
+   */
+  CouplingMatrix (const CouplingMatrix & other);
+  CouplingMatrix & operator= (const CouplingMatrix & other);
+
   /**
    * \returns The (i,j) entry of the matrix.
    */
@@ -98,6 +108,31 @@ public:
 
   CouplingMatrix & operator&= (const CouplingMatrix & other);
 
+  /**
+   * Sets every entry (i,j) with \p i_begin <= i < \p i_end and
+   * \p j_begin <= j < \p j_end, e.g. to couple all the species of one
+   * reaction block, in time proportional to the number of rows
+   * rather than the number of entries.
+   */
+  void set_block (const unsigned int i_begin,
+                  const unsigned int i_end,
+                  const unsigned int j_begin,
+                  const unsigned int j_end);
+
+  /**
+   * \returns The column indices j of the nonzero entries (i,j) of row
+   * \p i, in increasing order.
+   *
+   * The indices of every row are computed together, in time
+   * proportional to the number of nonzeros, on the first call after
+   * the matrix is modified, so code which needs them for every
+   * element, such as a sparsity pattern build, does not pay for
+   * O(size^2) entry lookups per element.  This may be called from
+   * several threads at once, as long as none of them is modifying the
+   * matrix.
+   */
+  SimpleRange<const unsigned int *> row_indices (const unsigned int i) const;
+
 private:
 
   friend class ConstCouplingAccessor;
@@ -124,6 +159,32 @@ private:
    * The size of the matrix.
    */
   unsigned int _size;
+
+  /**
+   * Fills the row index cache if it is out of date.
+   */
+  void build_row_indices () const;
+
+  /**
+   * Marks the row index cache as out of date; called by everything
+   * which modifies _ranges.
+   */
+  void invalidate_row_indices () { _row_indices_valid = false; }
+
+  /**
+   * The column indices of all nonzeros, row by row, and the offset
+   * of each row's first index in that list, with a final offset for
+   * the end of the last row.
+   */
+  mutable std::vector<unsigned int> _row_indices;
+  mutable std::vector<std::size_t> _row_offsets;
+
+  /**
+   * Whether the row index cache matches _ranges, and a mutex
+   * guarding its construction.
+   */
+  mutable std::atomic<bool> _row_indices_valid;
+  mutable std::mutex _row_indices_mutex;
 };
 
 
@@ -210,6 +271,8 @@ public:
   {
     const std::size_t max_size = std::numeric_limits<std::size_t>::max();
 
+    _my_mat.invalidate_row_indices();
+
     // Find the range that might contain i,j
     // lower_bound isn't *quite* what we want
     CouplingMatrix::rc_type::iterator lb =
@@ -566,13 +629,32 @@ ConstCouplingRow::const_iterator ConstCouplingRow::end() const {
 // CouplingMatrix inline methods
 inline
 CouplingMatrix::CouplingMatrix (const unsigned int n) :
-  _ranges(), _size(n)
+  _ranges(), _size(n), _row_indices_valid(false)
 {
   this->resize(n);
 }
 
 
 
+inline
+CouplingMatrix::CouplingMatrix (const CouplingMatrix & other) :
+  _ranges(other._ranges), _size(other._size), _row_indices_valid(false)
+{
+}
+
+
+
+inline
+CouplingMatrix & CouplingMatrix::operator= (const CouplingMatrix & other)
+{
+  _ranges = other._ranges;
+  _size = other._size;
+  this->invalidate_row_indices();
+  return *this;
+}
+
+
+
 inline
 bool CouplingMatrix::operator() (const unsigned int i,
                                  const unsigned int j) const
@@ -613,6 +695,7 @@ void CouplingMatrix::resize(const unsigned int n)
   _size = n;
 
   _ranges.clear();
+  this->invalidate_row_indices();
 }
 
 
@@ -632,6 +715,21 @@ bool CouplingMatrix::empty() const
 }
 
 
+
+inline
+SimpleRange<const unsigned int *>
+CouplingMatrix::row_indices (const unsigned int i) const
+{
+  libmesh_assert_less (i, _size);
+
+  if (!_row_indices_valid.load(std::memory_order_acquire))
+    this->build_row_indices();
+
+  const unsigned int * indices = _row_indices.data();
+  return {indices + _row_offsets[i], indices + _row_offsets[i+1]};
+}
+
+
 } // namespace libMesh
 
 
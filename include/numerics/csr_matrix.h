@@ -0,0 +1,278 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_CSR_MATRIX_H
+#define LIBMESH_CSR_MATRIX_H
+
+// Local includes
+#include "libmesh/sparse_matrix.h"
+#include "libmesh/threads.h"
+
+// C++ includes
+#include <complex>
+#include <vector>
+
+namespace libMesh
+{
+
+// Forward declarations
+template <typename T> class DenseMatrix;
+
+/**
+ * The single precision counterpart of a scalar type.
+ */
+template <typename T>
+struct SinglePrecisionType
+{
+  typedef float type;
+};
+
+template <typename T>
+struct SinglePrecisionType<std::complex<T>>
+{
+  typedef std::complex<float> type;
+};
+
+/**
+ * The CSRMatrix class is libMesh's own compressed sparse row matrix,
+ * used with \p NATIVE_SOLVERS so that builds without an external
+ * solver package still have a threaded sparse matrix.  Its structure
+ * is fixed by the full sparsity pattern from the DofMap, after which
+ * values may be added by several threads at once: \p add(), \p set()
+ * and \p add_matrix() lock the rows they touch.  Matrix-vector
+ * products with a \p DistributedVector are computed in parallel over
+ * rows.
+ *
+ * The values can optionally be stored in single precision, which
+ * halves the memory traffic of matrix-vector products in Krylov
+ * solves, e.g. for a Jacobian or preconditioner matrix, while vectors
+ * stay in full precision.  Values are still assembled in full
+ * precision and only rounded by close().
+ *
+ * Like \p LaspackMatrix, this class only works on a single processor.
+ * All overridden virtual functions are documented in sparse_matrix.h.
+ *
+ * \brief A threaded, serial compressed sparse row matrix.
+ */
+template <typename T>
+class CSRMatrix final : public SparseMatrix<T>
+{
+public:
+  /**
+   * Constructor; initializes the matrix to be empty, without any
+   * structure.  The structure is set by update_sparsity_pattern().
+   */
+  CSRMatrix (const Parallel::Communicator & comm);
+
+  /**
+   * The row locks are not copyable, so neither is this class.
+   */
+  CSRMatrix (CSRMatrix &&) = delete;
+  CSRMatrix (const CSRMatrix &) = delete;
+  CSRMatrix & operator= (const CSRMatrix &) = delete;
+  CSRMatrix & operator= (CSRMatrix &&) = delete;
+  virtual ~CSRMatrix () = default;
+
+  /**
+   * The \p CSRMatrix needs the full sparsity pattern.
+   */
+  virtual bool need_full_sparsity_pattern() const override
+  { return true; }
+
+  virtual void update_sparsity_pattern (const SparsityPattern::Graph &) override;
+
+  virtual void init (const numeric_index_type m,
+                     const numeric_index_type n,
+                     const numeric_index_type m_l,
+                     const numeric_index_type n_l,
+                     const numeric_index_type nnz=30,
+                     const numeric_index_type noz=10,
+                     const numeric_index_type blocksize=1) override;
+
+  virtual void init (ParallelType = PARALLEL) override;
+
+  virtual void clear () override;
+
+  virtual void zero () override;
+
+  virtual std::unique_ptr<SparseMatrix<T>> zero_clone () const override;
+
+  virtual std::unique_ptr<SparseMatrix<T>> clone () const override;
+
+  virtual void zero_rows (std::vector<numeric_index_type> & rows,
+                          T diag_value = 0.0) override;
+
+  virtual void close () override;
+
+  virtual numeric_index_type m () const override;
+
+  virtual numeric_index_type n () const override;
+
+  virtual numeric_index_type row_start () const override;
+
+  virtual numeric_index_type row_stop () const override;
+
+  virtual void set (const numeric_index_type i,
+                    const numeric_index_type j,
+                    const T value) override;
+
+  virtual void add (const numeric_index_type i,
+                    const numeric_index_type j,
+                    const T value) override;
+
+  using SparseMatrix<T>::add_matrix;
+
+  virtual void add_matrix (const DenseMatrix<T> & dm,
+                           const std::vector<numeric_index_type> & rows,
+                           const std::vector<numeric_index_type> & cols) override;
+
+  virtual void add_matrix (const DenseMatrix<T> & dm,
+                           const std::vector<numeric_index_type> & dof_indices) override;
+
+  virtual void add (const T a, const SparseMatrix<T> & X) override;
+
+  virtual T operator () (const numeric_index_type i,
+                         const numeric_index_type j) const override;
+
+  virtual Real l1_norm () const override;
+
+  virtual Real linfty_norm () const override;
+
+  virtual bool closed() const override { return _closed; }
+
+  virtual void print_personal(std::ostream & os=libMesh::out) const override { this->print(os); }
+
+  virtual void get_diagonal (NumericVector<T> & dest) const override;
+
+  virtual void get_transpose (SparseMatrix<T> & dest) const override;
+
+  virtual void get_row(numeric_index_type i,
+                       std::vector<numeric_index_type> & indices,
+                       std::vector<T> & values) const override;
+
+  /**
+   * Adds the product of this matrix (or of its transpose, if
+   * \p transpose is true) with the local entries of \p arg to those
+   * of \p dest.  The product with the matrix itself is computed in
+   * parallel over rows.  Used by \p DistributedVector::add_vector().
+   */
+  void vector_mult_add (T * dest, const T * arg, bool transpose = false) const;
+
+  /**
+   * Choose whether close() rounds the values to single precision
+   * storage.  After that, add(), set() and add_matrix() can only be
+   * used again after zero(); zero_rows() and add(a, X) restore full
+   * precision storage themselves.
+   */
+  void set_single_precision (bool single_precision);
+
+  /**
+   * \returns \p true if close() rounds the values to single
+   * precision storage.
+   */
+  bool single_precision () const { return _single_precision; }
+
+private:
+
+  typedef typename SinglePrecisionType<T>::type single_type;
+
+  /**
+   * \returns The value at position \p p, from whichever storage is
+   * current.
+   */
+  T value_at (const std::size_t p) const
+  { return _rounded ? T(_single_values[p]) : _values[p]; }
+
+  /**
+   * Moves rounded values back into full precision storage, so they
+   * can be modified.
+   */
+  void unround ();
+
+  /**
+   * The matrix-vector product with the values in \p values.
+   */
+  template <typename V>
+  void mult_add_with (const std::vector<V> & values,
+                      T * dest, const T * arg, bool transpose) const;
+
+  /**
+   * \returns The position in the value array of the \f$ (i,j) \f$
+   * entry, or an invalid position if the entry is not in the
+   * sparsity pattern.
+   */
+  std::size_t pos (const numeric_index_type i,
+                   const numeric_index_type j) const;
+
+  /**
+   * \returns The lock guarding row \p i.
+   */
+  Threads::spin_mutex & row_lock (const numeric_index_type i) const
+  { return _row_locks[i % n_row_locks]; }
+
+  /**
+   * The start of each row in \p _col_index and \p _values, followed
+   * by the total number of entries.
+   */
+  std::vector<std::size_t> _row_start;
+
+  /**
+   * The sorted column indices of the entries in each row.
+   */
+  std::vector<numeric_index_type> _col_index;
+
+  /**
+   * The entry values, in the same order as \p _col_index, unless
+   * they have been rounded to \p _single_values.
+   */
+  std::vector<T> _values;
+
+  /**
+   * The entry values after close() has rounded them, if
+   * \p _single_precision is set.
+   */
+  std::vector<single_type> _single_values;
+
+  /**
+   * Whether close() rounds the values to single precision
+   */
+  bool _single_precision;
+
+  /**
+   * Whether the values are currently in \p _single_values
+   */
+  bool _rounded;
+
+  /**
+   * Rows share locks in a fixed number of stripes, which keeps the
+   * cost of locking independent of the matrix size.
+   */
+  static const unsigned int n_row_locks = 128;
+
+  mutable Threads::spin_mutex _row_locks[n_row_locks];
+
+  /**
+   * Flag indicating if the matrix has been closed yet.
+   */
+  bool _closed;
+};
+
+} // namespace libMesh
+
+#endif // #ifdef LIBMESH_CSR_MATRIX_H
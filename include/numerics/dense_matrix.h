@@ -598,6 +598,34 @@ private:
    */
   std::vector<T> _val;
 
+  /**
+   * Sets \p *this, which must already be sized and zeroed, to \p A
+   * times \p B, working directly on the contiguous row-major storage
+   * of each.  Neither \p A nor \p B may be \p *this.
+   */
+  void _multiply_contiguous (const DenseMatrix<T> & A,
+                             const DenseMatrix<T> & B);
+
+  /**
+   * Adds \p a times the first \p n values of \p src to those of
+   * \p dest.  Row lengths common in element matrices are dispatched to
+   * loops with a fixed trip count, which compilers fully unroll and
+   * vectorize.
+   */
+  static void _add_scaled_row (const unsigned int n,
+                               const T & a,
+                               const T * src,
+                               T * dest);
+
+  template <unsigned int N>
+  static void _add_scaled_row_fixed (const T & a,
+                                     const T * src,
+                                     T * dest)
+  {
+    for (unsigned int j=0; j != N; ++j)
+      dest[j] += a * src[j];
+  }
+
   /**
    * Form the LU decomposition of the matrix.  This function
    * is private since it is only called as part of the implementation
@@ -51,11 +51,77 @@ namespace libMesh
 // ------------------------------------------------------------
 // Dense Matrix member functions
 
+template<typename T>
+void DenseMatrix<T>::_add_scaled_row (const unsigned int n,
+                                      const T & a,
+                                      const T * src,
+                                      T * dest)
+{
+  switch (n)
+    {
+    case 4:  _add_scaled_row_fixed<4>(a, src, dest); return;
+    case 8:  _add_scaled_row_fixed<8>(a, src, dest); return;
+    case 9:  _add_scaled_row_fixed<9>(a, src, dest); return;
+    case 16: _add_scaled_row_fixed<16>(a, src, dest); return;
+    case 27: _add_scaled_row_fixed<27>(a, src, dest); return;
+    default:
+      for (unsigned int j=0; j != n; ++j)
+        dest[j] += a * src[j];
+    }
+}
+
+
+
+template<typename T>
+void DenseMatrix<T>::_multiply_contiguous (const DenseMatrix<T> & A,
+                                           const DenseMatrix<T> & B)
+{
+  libmesh_assert_not_equal_to (&A, this);
+  libmesh_assert_not_equal_to (&B, this);
+  libmesh_assert_equal_to (this->m(), A.m());
+  libmesh_assert_equal_to (this->n(), B.n());
+  libmesh_assert_equal_to (A.n(), B.m());
+
+  const unsigned int m_s = A.m();
+  const unsigned int p_s = A.n();
+  const unsigned int n_s = B.n();
+
+  if (!m_s || !p_s || !n_s)
+    return;
+
+  // Each row of the result is a combination of rows of B.  Skipping
+  // zero coefficients pays off for sparse constraint matrices, and
+  // the contiguous inner loop vectorizes.
+  for (unsigned int i=0; i != m_s; ++i)
+    {
+      const T * a_row = &A._val[i*p_s];
+      T * c_row = &_val[i*n_s];
+
+      for (unsigned int k=0; k != p_s; ++k)
+        if (a_row[k] != 0.)
+          _add_scaled_row (n_s, a_row[k], &B._val[k*n_s], c_row);
+    }
+}
+
+
+
 template<typename T>
 void DenseMatrix<T>::left_multiply (const DenseMatrixBase<T> & M2)
 {
   if (this->use_blas_lapack)
     this->_multiply_blas(M2, LEFT_MULTIPLY);
+  else if (const DenseMatrix<T> * M2_dense =
+           dynamic_cast<const DenseMatrix<T> *>(&M2))
+    {
+      // M3 is a copy of *this before it gets resize()d, and can
+      // stand in for M2 too if we're squaring ourselves.
+      DenseMatrix<T> M3(*this);
+      const DenseMatrix<T> & A = (M2_dense == this) ? M3 : *M2_dense;
+
+      this->resize (A.m(), M3.n());
+
+      this->_multiply_contiguous(A, M3);
+    }
   else
     {
       // (*this) <- M2 * (*this)
@@ -229,6 +295,18 @@ void DenseMatrix<T>::right_multiply (const DenseMatrixBase<T> & M3)
 {
   if (this->use_blas_lapack)
     this->_multiply_blas(M3, RIGHT_MULTIPLY);
+  else if (const DenseMatrix<T> * M3_dense =
+           dynamic_cast<const DenseMatrix<T> *>(&M3))
+    {
+      // M2 is a copy of *this before it gets resize()d, and can
+      // stand in for M3 too if we're squaring ourselves.
+      DenseMatrix<T> M2(*this);
+      const DenseMatrix<T> & B = (M3_dense == this) ? M2 : *M3_dense;
+
+      this->resize (M2.m(), B.n());
+
+      this->_multiply_contiguous(M2, B);
+    }
   else
     {
       // (*this) <- (*this) * M3
@@ -418,9 +496,18 @@ void DenseMatrix<T>::vector_mult (DenseVector<T> & dest,
       const unsigned int n_rows = this->m();
       const unsigned int n_cols = this->n();
 
+      const T * x = arg.get_values().data();
+
       for (unsigned int i=0; i<n_rows; i++)
-        for (unsigned int j=0; j<n_cols; j++)
-          dest(i) += (*this)(i,j)*arg(j);
+        {
+          const T * row = &_val[i*n_cols];
+
+          T sum = 0.;
+          for (unsigned int j=0; j<n_cols; j++)
+            sum += row[j]*x[j];
+
+          dest(i) = sum;
+        }
     }
 }
 
@@ -482,9 +569,14 @@ void DenseMatrix<T>::vector_mult_transpose (DenseVector<T> & dest,
       //     dest(j) += (*this)(i,j)*arg(i);
 
       // ALSO WORKS, (i,j) just swapped
-      for (unsigned int i=0; i<n_cols; i++)
-        for (unsigned int j=0; j<n_rows; j++)
-          dest(i) += (*this)(j,i)*arg(j);
+      // for (unsigned int i=0; i<n_cols; i++)
+      //   for (unsigned int j=0; j<n_rows; j++)
+      //     dest(i) += (*this)(j,i)*arg(j);
+
+      // Fastest, adding whole contiguous rows at a time
+      T * y = dest.get_values().data();
+      for (unsigned int j=0; j<n_rows; j++)
+        _add_scaled_row (n_cols, arg(j), &_val[j*n_cols], y);
     }
 }
 
@@ -792,9 +884,10 @@ void DenseMatrix<T>::_lu_decompose ()
       // If we were scaling the i'th column as well, like
       // in Gaussian elimination, this would 'zero' the
       // entry in the i'th column.
-      for (unsigned int row=i+1; row<n_rows; ++row)
-        for (unsigned int col=i+1; col<n_rows; ++col)
-          A(row,col) -= A(row,i) * A(i,col);
+      if (i+1 < n_rows)
+        for (unsigned int row=i+1; row<n_rows; ++row)
+          _add_scaled_row (n_rows-i-1, -A(row,i),
+                           &_val[i*n_rows+i+1], &_val[row*n_rows+i+1]);
 
     } // end i loop
 
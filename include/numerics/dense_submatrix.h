@@ -117,6 +117,32 @@ public:
    */
   unsigned int j_off() const { return _j_off; }
 
+  /**
+   * \returns A pointer to the \p (0,0) element of the submatrix in
+   * the row-major storage of the parent matrix.  The entries of each
+   * row are contiguous, and consecutive rows are leading_dimension()
+   * entries apart, so kernels accumulating into several blocks of an
+   * element matrix can hoist the offset arithmetic of operator() out
+   * of their inner loops.
+   *
+   * \note The pointer is invalidated if the parent matrix is resized.
+   */
+  T * data();
+  const T * data() const;
+
+  /**
+   * \returns A pointer to the first element of row \p i of the
+   * submatrix.
+   */
+  T * row_data(const unsigned int i);
+  const T * row_data(const unsigned int i) const;
+
+  /**
+   * \returns The distance between the starts of consecutive rows in
+   * data(), i.e. the number of columns of the parent matrix.
+   */
+  unsigned int leading_dimension() const { return _parent_matrix.n(); }
+
   /**
    * Condense-out the \p (i,j) entry of the matrix, forcing
    * it to take on the value \p val.  This is useful in numerical
@@ -229,6 +255,50 @@ T & DenseSubMatrix<T>::operator () (const unsigned int i,
 }
 
 
+
+
+template<typename T>
+inline
+T * DenseSubMatrix<T>::data()
+{
+  return _parent_matrix.get_values().data() +
+    this->i_off() * this->leading_dimension() + this->j_off();
+}
+
+
+
+template<typename T>
+inline
+const T * DenseSubMatrix<T>::data() const
+{
+  const DenseMatrix<T> & parent_matrix = _parent_matrix;
+  return parent_matrix.get_values().data() +
+    this->i_off() * this->leading_dimension() + this->j_off();
+}
+
+
+
+template<typename T>
+inline
+T * DenseSubMatrix<T>::row_data(const unsigned int i)
+{
+  libmesh_assert_less (i, this->m());
+
+  return this->data() + i * this->leading_dimension();
+}
+
+
+
+template<typename T>
+inline
+const T * DenseSubMatrix<T>::row_data(const unsigned int i) const
+{
+  libmesh_assert_less (i, this->m());
+
+  return this->data() + i * this->leading_dimension();
+}
+
+
 } // namespace libMesh
 
 
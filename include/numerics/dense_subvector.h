@@ -98,6 +98,20 @@ public:
    */
   unsigned int i_off() const { return _i_off; }
 
+  /**
+   * \returns A pointer to the first element of the subvector in the
+   * contiguous storage of the parent vector.
+   *
+   * \note The pointer is invalidated if the parent vector is resized.
+   */
+  T * data() { return _parent_vector.get_values().data() + this->i_off(); }
+
+  const T * data() const
+  {
+    const DenseVector<T> & parent_vector = _parent_vector;
+    return parent_vector.get_values().data() + this->i_off();
+  }
+
   /**
    * Changes the location of the subvector in the parent vector.
    */
@@ -0,0 +1,134 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_DENSE_UNIFORM_BLOCKS_H
+#define LIBMESH_DENSE_UNIFORM_BLOCKS_H
+
+// Local Includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/dense_matrix.h"
+
+namespace libMesh
+{
+
+/**
+ * A non-owning view of a square DenseMatrix partitioned into
+ * \p NBlocks by \p NBlocks blocks of equal size, such as the element
+ * Jacobian of a system whose \p NBlocks variables all have the same
+ * finite element type.  Block \p (bi,bj) plays the role of
+ * DiffContext::get_elem_jacobian(bi,bj), but its offsets are computed
+ * from the block indices rather than looked up in a DenseSubMatrix,
+ * so loops over several blocks can be unrolled and vectorized.
+ *
+ * If the number of dofs per block is known at compile time it may be
+ * given as \p BlockSize; otherwise it is computed from the size of the
+ * matrix.
+ *
+ * \note The view is invalidated if the matrix is resized.
+ */
+template <typename T, unsigned int NBlocks, unsigned int BlockSize = 0>
+class DenseUniformBlocks
+{
+public:
+  /**
+   * Constructor.  \p mat must be square, with a size which is
+   * \p NBlocks times the block size.
+   */
+  explicit
+  DenseUniformBlocks (DenseMatrix<T> & mat);
+
+  /**
+   * \returns The number of rows and columns of each block.
+   */
+  unsigned int block_size() const
+  { return BlockSize ? BlockSize : _block_size; }
+
+  /**
+   * \returns The distance between the starts of consecutive rows.
+   */
+  unsigned int leading_dimension() const
+  { return NBlocks * this->block_size(); }
+
+  /**
+   * \returns A pointer to the first element of row \p i of block
+   * \p (bi,bj).  The block_size() entries of the row are contiguous.
+   */
+  T * row_data (const unsigned int bi,
+                const unsigned int bj,
+                const unsigned int i);
+
+  /**
+   * \returns The \p (i,j) element of block \p (bi,bj) as a writable
+   * reference.
+   */
+  T & operator() (const unsigned int bi,
+                  const unsigned int bj,
+                  const unsigned int i,
+                  const unsigned int j)
+  { return this->row_data(bi, bj, i)[j]; }
+
+private:
+
+  /**
+   * The row-major storage of the matrix.
+   */
+  T * _data;
+
+  /**
+   * The block size, when \p BlockSize is not given.
+   */
+  unsigned int _block_size;
+};
+
+
+
+// ------------------------------------------------------------
+// DenseUniformBlocks member functions
+template <typename T, unsigned int NBlocks, unsigned int BlockSize>
+inline
+DenseUniformBlocks<T, NBlocks, BlockSize>::DenseUniformBlocks (DenseMatrix<T> & mat) :
+  _data(mat.get_values().data()),
+  _block_size(mat.n() / NBlocks)
+{
+  static_assert(NBlocks > 0, "DenseUniformBlocks requires at least one block");
+
+  libmesh_assert_equal_to (mat.m(), mat.n());
+  libmesh_assert_equal_to (mat.n(), this->leading_dimension());
+}
+
+
+
+template <typename T, unsigned int NBlocks, unsigned int BlockSize>
+inline
+T * DenseUniformBlocks<T, NBlocks, BlockSize>::row_data (const unsigned int bi,
+                                                         const unsigned int bj,
+                                                         const unsigned int i)
+{
+  libmesh_assert_less (bi, NBlocks);
+  libmesh_assert_less (bj, NBlocks);
+  libmesh_assert_less (i, this->block_size());
+
+  return _data + (bi * this->block_size() + i) * this->leading_dimension()
+    + bj * this->block_size();
+}
+
+} // namespace libMesh
+
+
+#endif // LIBMESH_DENSE_UNIFORM_BLOCKS_H
@@ -121,6 +121,8 @@ public:
 
   void add(const numeric_index_type i, const numeric_index_type j, const T value) override;
 
+  using SparseMatrix<T>::add_matrix;
+
   void add_matrix(const DenseMatrix<T> & dm,
                   const std::vector<numeric_index_type> & rows,
                   const std::vector<numeric_index_type> & cols) override;
@@ -28,6 +28,7 @@
 #include "libmesh/int_range.h"
 #include "libmesh/numeric_vector.h"
 #include "libmesh/parallel.h"
+#include "libmesh/threads_allocators.h"
 
 // C++ includes
 #include <vector>
@@ -191,13 +192,17 @@ public:
    */
   using NumericVector<T>::add_vector;
 
-  virtual void add_vector (const NumericVector<T> &,
-                           const SparseMatrix<T> &) override
-  { libmesh_not_implemented(); }
+  /**
+   * Only implemented for a \p CSRMatrix.
+   */
+  virtual void add_vector (const NumericVector<T> & v,
+                           const SparseMatrix<T> & A) override;
 
-  virtual void add_vector_transpose (const NumericVector<T> &,
-                                     const SparseMatrix<T> &) override
-  { libmesh_not_implemented(); }
+  /**
+   * Only implemented for a \p CSRMatrix.
+   */
+  virtual void add_vector_transpose (const NumericVector<T> & v,
+                                     const SparseMatrix<T> & A) override;
 
   virtual void scale (const T factor) override;
 
@@ -229,12 +234,19 @@ public:
 
   virtual std::size_t max_allowed_id() const override;
 
+protected:
+
+  virtual T * get_local_array (bool read_only,
+                               const typename NumericVector<T>::GhostIndexMap *& ghost_map) const override;
+
 private:
 
   /**
-   * Actual vector datatype to hold vector entries.
+   * Actual vector datatype to hold vector entries.  Its allocator
+   * leaves new real entries unwritten, so that init() can first
+   * touch them from threads if Threads::parallel_first_touch is set.
    */
-  std::vector<T> _values;
+  std::vector<T, Threads::first_touch_allocator<T>> _values;
 
   /**
    * The global vector size.
@@ -348,6 +360,20 @@ void DistributedVector<T>::init (const numeric_index_type n,
 
   // Initialize data structures
   _values.resize(n_local);
+
+  // Zero the values, in threads which are then their NUMA-local
+  // first users if requested
+  if (Threads::parallel_first_touch && !Threads::in_threads)
+    Threads::parallel_for
+      (Threads::BlockedRange<numeric_index_type>(0, n_local),
+       [this](const Threads::BlockedRange<numeric_index_type> & range)
+       {
+         std::fill (_values.begin() + range.begin(),
+                    _values.begin() + range.end(),
+                    T(0));
+       });
+  else
+    std::fill (_values.begin(), _values.end(), T(0));
   _local_size  = n_local;
   _global_size = n;
 
@@ -669,6 +695,19 @@ std::size_t DistributedVector<T>::max_allowed_id () const
   return std::numeric_limits<typename std::vector<T>::size_type>::max();
 }
 
+
+template <typename T>
+inline
+T * DistributedVector<T>::get_local_array (bool /*read_only*/,
+                                           const typename NumericVector<T>::GhostIndexMap *& ghost_map) const
+{
+  libmesh_assert (this->initialized());
+  libmesh_assert_equal_to (_values.size(), _local_size);
+
+  ghost_map = nullptr;
+  return const_cast<T *>(_values.data());
+}
+
 } // namespace libMesh
 
 
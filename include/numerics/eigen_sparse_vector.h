@@ -239,6 +239,11 @@ public:
   DataType &       vec ()        { return _vec; }
   const DataType & vec () const  { return _vec; }
 
+protected:
+
+  virtual T * get_local_array (bool read_only,
+                               const typename NumericVector<T>::GhostIndexMap *& ghost_map) const override;
+
 private:
 
   /**
@@ -539,6 +544,18 @@ std::size_t EigenSparseVector<T>::max_allowed_id () const
   return std::numeric_limits<int>::max();
 }
 
+
+template <typename T>
+inline
+T * EigenSparseVector<T>::get_local_array (bool /*read_only*/,
+                                           const typename NumericVector<T>::GhostIndexMap *& ghost_map) const
+{
+  libmesh_assert (this->initialized());
+
+  ghost_map = nullptr;
+  return const_cast<T *>(_vec.data());
+}
+
 } // namespace libMesh
 
 
@@ -125,6 +125,33 @@ public:
                            unsigned int i,
                            const Point & p,
                            Real time=0.);
+
+  /**
+   * Evaluates the scalar function value at each of \p points at time
+   * \p time, resizing \p output to match.
+   *
+   * \note The default implementation calls \p operator() once per
+   * point; subclasses which can evaluate a whole batch at once
+   * should override this.
+   */
+  virtual void values(const FEMContext &,
+                      const std::vector<Point> & points,
+                      const Real time,
+                      std::vector<Output> & output);
+
+  /**
+   * Evaluates vector component \p i at each of \p points at time \p
+   * time, resizing \p output to match.
+   *
+   * \note The default implementation calls \p component() once per
+   * point; subclasses which can evaluate a whole batch at once
+   * should override this.
+   */
+  virtual void component_values(const FEMContext &,
+                                unsigned int i,
+                                const std::vector<Point> & points,
+                                const Real time,
+                                std::vector<Output> & output);
 };
 
 template <typename Output>
@@ -149,6 +176,31 @@ void FEMFunctionBase<Output>::operator() (const FEMContext & context,
   this->operator()(context, p, 0., output);
 }
 
+template <typename Output>
+inline
+void FEMFunctionBase<Output>::values (const FEMContext & context,
+                                      const std::vector<Point> & points,
+                                      const Real time,
+                                      std::vector<Output> & output)
+{
+  output.resize(points.size());
+  for (std::size_t i = 0, n = points.size(); i != n; ++i)
+    output[i] = (*this)(context, points[i], time);
+}
+
+template <typename Output>
+inline
+void FEMFunctionBase<Output>::component_values (const FEMContext & context,
+                                                unsigned int i,
+                                                const std::vector<Point> & points,
+                                                const Real time,
+                                                std::vector<Output> & output)
+{
+  output.resize(points.size());
+  for (std::size_t j = 0, n = points.size(); j != n; ++j)
+    output[j] = this->component(context, i, points[j], time);
+}
+
 } // namespace libMesh
 
 #endif // LIBMESH_FEM_FUNCTION_BASE_H
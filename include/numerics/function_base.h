@@ -23,17 +23,16 @@
 // Local Includes
 #include "libmesh/libmesh_common.h"
 #include "libmesh/dense_vector.h" // required to instantiate a DenseVector<> below
+#include "libmesh/point.h"
 
 // C++ includes
 #include <cstddef>
 #include <memory>
+#include <vector>
 
 namespace libMesh
 {
 
-// Forward Declarations
-class Point;
-
 /**
  * \brief Base class for functors that can be evaluated at a point and
  * (optionally) time.
@@ -141,6 +140,31 @@ public:
                            const Point & p,
                            Real time=0.);
 
+  /**
+   * Evaluates the scalar function value at each of \p points at time
+   * \p time, resizing \p output to match.
+   *
+   * \note The default implementation calls \p operator() once per
+   * point; subclasses which can evaluate a whole batch at once
+   * should override this.
+   */
+  virtual void values(const std::vector<Point> & points,
+                      const Real time,
+                      std::vector<Output> & output);
+
+  /**
+   * Evaluates vector component \p i at each of \p points at time \p
+   * time, resizing \p output to match.
+   *
+   * \note The default implementation calls \p component() once per
+   * point; subclasses which can evaluate a whole batch at once
+   * should override this.
+   */
+  virtual void component_values(unsigned int i,
+                                const std::vector<Point> & points,
+                                const Real time,
+                                std::vector<Output> & output);
+
 
   /**
    * \returns \p true when this object is properly initialized
@@ -244,6 +268,33 @@ void FunctionBase<Output>::operator() (const Point & p,
   this->operator()(p, 0., output);
 }
 
+
+
+template <typename Output>
+inline
+void FunctionBase<Output>::values (const std::vector<Point> & points,
+                                   const Real time,
+                                   std::vector<Output> & output)
+{
+  output.resize(points.size());
+  for (std::size_t i = 0, n = points.size(); i != n; ++i)
+    output[i] = (*this)(points[i], time);
+}
+
+
+
+template <typename Output>
+inline
+void FunctionBase<Output>::component_values (unsigned int i,
+                                             const std::vector<Point> & points,
+                                             const Real time,
+                                             std::vector<Output> & output)
+{
+  output.resize(points.size());
+  for (std::size_t j = 0, n = points.size(); j != n; ++j)
+    output[j] = this->component(i, points[j], time);
+}
+
 } // namespace libMesh
 
 #endif // LIBMESH_FUNCTION_BASE_H
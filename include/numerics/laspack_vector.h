@@ -230,6 +230,11 @@ public:
 
   virtual std::size_t max_allowed_id() const override;
 
+protected:
+
+  virtual T * get_local_array (bool read_only,
+                               const typename NumericVector<T>::GhostIndexMap *& ghost_map) const override;
+
 private:
 
   /**
@@ -572,6 +577,19 @@ std::size_t LaspackVector<T>::max_allowed_id () const
 }
 
 
+template <typename T>
+inline
+T * LaspackVector<T>::get_local_array (bool /*read_only*/,
+                                       const typename NumericVector<T>::GhostIndexMap *& ghost_map) const
+{
+  libmesh_assert (this->initialized());
+
+  // QVector components are numbered from 1
+  ghost_map = nullptr;
+  return _vec.Cmp + 1;
+}
+
+
 } // namespace libMesh
 
 
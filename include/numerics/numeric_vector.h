@@ -43,6 +43,7 @@ enum SolverPackage : int;
 // C++ includes
 #include <cstddef>
 #include <set>
+#include <unordered_map>
 #include <vector>
 #include <memory>
 
@@ -170,12 +171,40 @@ public:
    */
   virtual bool closed() const { return _is_closed; }
 
+  /**
+   * \returns \p true if several threads may call add_vector() at
+   * once, as long as no two of them add to the same entries.
+   *
+   * This is false unless the underlying library is known to be
+   * thread-safe; callers must otherwise serialize their insertions.
+   */
+  virtual bool supports_concurrent_insertion() const { return false; }
+
   /**
    * Calls the NumericVector's internal assembly routines, ensuring
    * that the values are consistent across processors.
    */
   virtual void close () = 0;
 
+  /**
+   * Starts the work of \p close(): after this returns the locally
+   * owned entries are consistent and may be read, but ghost entries
+   * may not be read until \p end_ghost_update() has been called.
+   * Work which only needs owned entries can be done between the two
+   * calls to overlap it with the ghost value communication.
+   *
+   * The default implementation does nothing.
+   */
+  virtual void begin_ghost_update () {}
+
+  /**
+   * Finishes the work started by \p begin_ghost_update(), after which
+   * the vector is closed.
+   *
+   * The default implementation calls \p close().
+   */
+  virtual void end_ghost_update () { this->close(); }
+
   /**
    * Restores the \p NumericVector<T> to a pristine state.
    */
@@ -476,6 +505,10 @@ public:
    * Computes \f$ \vec{u} \leftarrow \vec{u} + \vec{v} \f$,
    * where \p v is a std::vector and each \p dof_indices[i] specifies
    * where to add value \p v[i].
+   *
+   * Indices may be repeated, in which case all their values are
+   * added, so this can be used to add many concatenated element
+   * vectors in a single call.
    */
   void add_vector (const std::vector<T> & v,
                    const std::vector<numeric_index_type> & dof_indices);
@@ -730,8 +763,177 @@ public:
    */
   virtual std::size_t max_allowed_id() const = 0;
 
+  /**
+   * Type for maps from the global indices of ghost entries to their
+   * positions in the local array.
+   */
+  typedef std::unordered_map<numeric_index_type, numeric_index_type> GhostIndexMap;
+
+  /**
+   * Common base of \p ReadView and \p WriteView.  Maps global
+   * indices of local and ghost entries to positions in the local
+   * array, without a virtual call.
+   */
+  class LocalArrayView
+  {
+  public:
+    /**
+     * \returns The position of the entry with global index \p i in
+     * the local array.  \p i must be owned by this processor or be
+     * one of this vector's ghost indices.
+     */
+    numeric_index_type local_index (const numeric_index_type i) const
+    {
+      if (i >= _first && i < _last)
+        return i - _first;
+
+      libmesh_assert_msg(_ghost_map, "No index " << i << " in local range ["
+                         << _first << ',' << _last << ") of an unghosted vector");
+      const auto it = _ghost_map->find(i);
+      libmesh_assert_msg(it != _ghost_map->end(), "No index " << i << " in ghosted vector");
+      return it->second;
+    }
+
+    /**
+     * \returns The global index of the first entry owned by this
+     * processor, which is stored first in the local array.
+     */
+    numeric_index_type first_local_index () const { return _first; }
+
+    /**
+     * \returns The global index + 1 of the last entry owned by this
+     * processor.  Any ghost entries follow the owned entries in the
+     * local array.
+     */
+    numeric_index_type last_local_index () const { return _last; }
+
+  protected:
+    LocalArrayView (const NumericVector<T> & vec) :
+      _first(vec.first_local_index()),
+      _last(vec.last_local_index()),
+      _ghost_map(nullptr)
+    {}
+
+    numeric_index_type _first, _last;
+    const GhostIndexMap * _ghost_map;
+  };
+
+  /**
+   * Read-only access to the entries of a vector stored on this
+   * processor, owned and ghosted, straight from the underlying
+   * array: entries are read with no virtual call and no copy.
+   *
+   * The vector's array is held for the lifetime of the view, during
+   * which the vector must not be modified by other means.
+   */
+  class ReadView : public LocalArrayView
+  {
+  public:
+    explicit ReadView (const NumericVector<T> & vec) :
+      LocalArrayView(vec),
+      _vec(vec),
+      _values(vec.get_local_array(/*read_only=*/ true, this->_ghost_map))
+    {}
+
+    ~ReadView () { _vec.release_local_array(/*read_only=*/ true); }
+
+    ReadView (const ReadView &) = delete;
+    ReadView & operator= (const ReadView &) = delete;
+
+    /**
+     * \returns The entry with global index \p i.
+     */
+    T operator() (const numeric_index_type i) const
+    { return _values[this->local_index(i)]; }
+
+    /**
+     * Fills \p values, which must have room for them, with the
+     * entries at the global indices \p index.
+     */
+    void get (const std::vector<numeric_index_type> & index,
+              T * values) const
+    {
+      for (auto i : index_range(index))
+        values[i] = (*this)(index[i]);
+    }
+
+    /**
+     * \returns The local array: the owned entries in order, followed
+     * by any ghost entries.
+     */
+    const T * data () const { return _values; }
+
+  private:
+    const NumericVector<T> & _vec;
+    const T * _values;
+  };
+
+  /**
+   * Read-write access to the entries of a vector stored on this
+   * processor, owned and ghosted, straight from the underlying
+   * array.  Changes to ghost entries only affect the local copy;
+   * they are not sent to the entries' owners.
+   *
+   * The vector's array is held for the lifetime of the view, during
+   * which the vector must not be accessed by other means.
+   */
+  class WriteView : public LocalArrayView
+  {
+  public:
+    explicit WriteView (NumericVector<T> & vec) :
+      LocalArrayView(vec),
+      _vec(vec),
+      _values(vec.get_local_array(/*read_only=*/ false, this->_ghost_map))
+    {}
+
+    ~WriteView () { _vec.release_local_array(/*read_only=*/ false); }
+
+    WriteView (const WriteView &) = delete;
+    WriteView & operator= (const WriteView &) = delete;
+
+    /**
+     * \returns A reference to the entry with global index \p i.
+     */
+    T & operator() (const numeric_index_type i) const
+    { return _values[this->local_index(i)]; }
+
+    /**
+     * \returns The local array: the owned entries in order, followed
+     * by any ghost entries.
+     */
+    T * data () const { return _values; }
+
+  private:
+    NumericVector<T> & _vec;
+    T * _values;
+  };
+
 protected:
 
+  /**
+   * \returns The entries stored on this processor as one contiguous
+   * array, owned entries first, and sets \p ghost_map to the
+   * positions of any ghost entries in it, or to \p nullptr for an
+   * unghosted vector.  Used by \p ReadView and \p WriteView; each
+   * call is matched by a call to \p release_local_array().
+   *
+   * Subclasses with contiguous local storage should override this;
+   * the default implementation throws an error.
+   */
+  virtual T * get_local_array (bool /*read_only*/,
+                               const GhostIndexMap *& /*ghost_map*/) const
+  {
+    libmesh_not_implemented();
+    return nullptr;
+  }
+
+  /**
+   * Ends an access begun with \p get_local_array(), making any
+   * changes made through the array visible to the rest of the
+   * vector's interface.
+   */
+  virtual void release_local_array (bool /*read_only*/) const {}
+
   /**
    * Flag which tracks whether the vector's values are consistent on
    * all processors after insertion or addition of values has occurred
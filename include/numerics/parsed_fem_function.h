@@ -31,7 +31,7 @@
 
 #ifdef LIBMESH_HAVE_FPARSER
 // FParser includes
-#include "libmesh/fparser.hh"
+#include "libmesh/fparser_ad.hh"
 #endif
 
 // C++ includes
@@ -100,6 +100,22 @@ public:
                    const Real time,
                    DenseVector<Output> & output) override;
 
+  /**
+   * Evaluates the first component of the function at each of \p
+   * points on the current element of \p c at time \p time, resizing
+   * \p output to match, with one call for the whole batch.
+   */
+  void operator() (const FEMContext & c,
+                   const std::vector<Point> & points,
+                   const Real time,
+                   std::vector<Output> & output);
+
+  virtual void values (const FEMContext & c,
+                       const std::vector<Point> & points,
+                       const Real time,
+                       std::vector<Output> & output) override
+  { (*this)(c, points, time, output); }
+
   virtual Output component(const FEMContext & c,
                            unsigned int i,
                            const Point & p,
@@ -107,6 +123,17 @@ public:
 
   const std::string & expression() { return _expression; }
 
+  /**
+   * Compiles the expression to native code with fparser's JIT, now
+   * and after any reparse.  With \p use_cache, compiled objects are
+   * kept in a ".jitcache" directory keyed by a hash of the bytecode,
+   * so later runs skip the compiler.
+   *
+   * Without JIT support (or for value types it cannot compile) the
+   * bytecode interpreter is silently kept.
+   */
+  void enable_jit (bool use_cache = true);
+
   /**
    * \returns The value of an inline variable.
    *
@@ -138,6 +165,9 @@ protected:
   std::size_t find_name (const std::string & varname,
                          const std::string & expr) const;
 
+  // JIT compile every parser, if enable_jit() was called
+  void jit_compile();
+
   // Helper function for evaluating function arguments
   void eval_args(const FEMContext & c,
                  const Point & p,
@@ -145,7 +175,7 @@ protected:
 
   // Evaluate the ith FunctionParser and check the result
 #ifdef LIBMESH_HAVE_FPARSER
-  inline Output eval(FunctionParserBase<Output> & parser,
+  inline Output eval(FunctionParserADBase<Output> & parser,
                      const std::string & libmesh_dbg_var(function_name),
                      unsigned int libmesh_dbg_var(component_idx)) const;
 #else // LIBMESH_HAVE_FPARSER
@@ -163,8 +193,9 @@ private:
     _n_requested_grad_components,
     _n_requested_hess_components;
   bool _requested_normals;
+  bool _jit, _jit_cache;
 #ifdef LIBMESH_HAVE_FPARSER
-  std::vector<std::unique_ptr<FunctionParserBase<Output>>> parsers;
+  std::vector<std::unique_ptr<FunctionParserADBase<Output>>> parsers;
 #else
   std::vector<char*> parsers;
 #endif
@@ -206,6 +237,8 @@ ParsedFEMFunction<Output>::ParsedFEMFunction (const System & sys,
   _n_requested_grad_components(0),
   _n_requested_hess_components(0),
   _requested_normals(false),
+  _jit(false),
+  _jit_cache(false),
   _need_var(_n_vars, false),
   _need_var_grad(_n_vars*LIBMESH_DIM, false),
 #ifdef LIBMESH_ENABLE_SECOND_DERIVATIVES
@@ -230,6 +263,8 @@ ParsedFEMFunction<Output>::ParsedFEMFunction (const ParsedFEMFunction<Output> &
   _n_requested_grad_components(other._n_requested_grad_components),
   _n_requested_hess_components(other._n_requested_hess_components),
   _requested_normals(other._requested_normals),
+  _jit(other._jit),
+  _jit_cache(other._jit_cache),
   _spacetime(other._spacetime),
   _need_var(other._need_var),
   _need_var_grad(other._need_var_grad),
@@ -425,8 +460,11 @@ inline
 std::unique_ptr<FEMFunctionBase<Output>>
 ParsedFEMFunction<Output>::clone () const
 {
-  return libmesh_make_unique<ParsedFEMFunction>
+  auto new_func = libmesh_make_unique<ParsedFEMFunction>
     (_sys, _expression, &_additional_vars, &_initial_vals);
+  if (_jit)
+    new_func->enable_jit(_jit_cache);
+  return new_func;
 }
 
 template <typename Output>
@@ -462,6 +500,25 @@ ParsedFEMFunction<Output>::operator() (const FEMContext & c,
 }
 
 
+
+template <typename Output>
+inline
+void
+ParsedFEMFunction<Output>::operator() (const FEMContext & c,
+                                       const std::vector<Point> & points,
+                                       const Real time,
+                                       std::vector<Output> & output)
+{
+  output.resize(points.size());
+
+  for (auto i : index_range(points))
+    {
+      eval_args(c, points[i], time);
+      output[i] = eval(*parsers[0], "f", 0);
+    }
+}
+
+
 template <typename Output>
 inline
 Output
@@ -516,7 +573,7 @@ ParsedFEMFunction<Output>::get_inline_value(const std::string & inline_var_name)
 #ifdef LIBMESH_HAVE_FPARSER
       // Parse and evaluate the new subexpression.
       // Add the same constants as we used originally.
-      auto fp = libmesh_make_unique<FunctionParserBase<Output>>();
+      auto fp = libmesh_make_unique<FunctionParserADBase<Output>>();
       fp->AddConstant("NaN", std::numeric_limits<Real>::quiet_NaN());
       fp->AddConstant("pi", std::acos(Real(-1)));
       fp->AddConstant("e", std::exp(Real(1)));
@@ -658,7 +715,7 @@ ParsedFEMFunction<Output>::partial_reparse (const std::string & expression)
 #ifdef LIBMESH_HAVE_FPARSER
       // Parse (and optimize if possible) the subexpression.
       // Add some basic constants, to Real precision.
-      auto fp = libmesh_make_unique<FunctionParserBase<Output>>();
+      auto fp = libmesh_make_unique<FunctionParserADBase<Output>>();
       fp->AddConstant("NaN", std::numeric_limits<Real>::quiet_NaN());
       fp->AddConstant("pi", std::acos(Real(-1)));
       fp->AddConstant("e", std::exp(Real(1)));
@@ -677,6 +734,40 @@ ParsedFEMFunction<Output>::partial_reparse (const std::string & expression)
       nextstart = (end == std::string::npos) ?
         std::string::npos : end + 1;
     }
+
+  this->jit_compile();
+}
+
+
+
+template <typename Output>
+inline
+void
+ParsedFEMFunction<Output>::enable_jit (bool use_cache)
+{
+  _jit = true;
+  _jit_cache = use_cache;
+  this->jit_compile();
+}
+
+
+
+template <typename Output>
+inline
+void
+ParsedFEMFunction<Output>::jit_compile ()
+{
+#ifdef LIBMESH_HAVE_FPARSER
+  if (!_jit)
+    return;
+
+  // A failed compilation leaves the parser on its bytecode
+  for (auto & fp : parsers)
+    {
+      fp->SetADFlags(FunctionParserADBase<Output>::ADJITCache, _jit_cache);
+      fp->JITCompile();
+    }
+#endif
 }
 
 template <typename Output>
@@ -837,7 +928,7 @@ ParsedFEMFunction<Output>::eval_args (const FEMContext & c,
 template <typename Output>
 inline
 Output
-ParsedFEMFunction<Output>::eval (FunctionParserBase<Output> & parser,
+ParsedFEMFunction<Output>::eval (FunctionParserADBase<Output> & parser,
                                  const std::string & libmesh_dbg_var(function_name),
                                  unsigned int libmesh_dbg_var(component_idx)) const
 {
@@ -100,12 +100,42 @@ public:
                            const Real time,
                            DenseVector<Output> & output) override;
 
+  /**
+   * Evaluates the first component of the function at each of \p
+   * points at time \p time, resizing \p output to match, with one
+   * call for the whole batch.
+   */
+  void operator() (const std::vector<Point> & points,
+                   const Real time,
+                   std::vector<Output> & output);
+
+  virtual void values (const std::vector<Point> & points,
+                       const Real time,
+                       std::vector<Output> & output) override
+  { (*this)(points, time, output); }
+
   virtual Output component (unsigned int i,
                             const Point & p,
                             Real time) override;
 
+  virtual void component_values (unsigned int i,
+                                 const std::vector<Point> & points,
+                                 const Real time,
+                                 std::vector<Output> & output) override;
+
   const std::string & expression() { return _expression; }
 
+  /**
+   * Compiles the expression and its derivatives to native code with
+   * fparser's JIT, now and after any reparse.  With \p use_cache,
+   * compiled objects are kept in a ".jitcache" directory keyed by a
+   * hash of the bytecode, so later runs skip the compiler.
+   *
+   * Without JIT support (or for value types it cannot compile) the
+   * bytecode interpreter is silently kept.
+   */
+  void enable_jit (bool use_cache = true);
+
   /**
    * \returns The address of a parsed variable so you can supply a parameterized value.
    */
@@ -154,6 +184,11 @@ protected:
   bool expression_is_time_dependent( const std::string & expression ) const;
 
 private:
+  /**
+   * JIT compile every parser, if \p enable_jit() was called.
+   */
+  void jit_compile();
+
   /**
    * Set the _spacetime argument vector.
    */
@@ -183,6 +218,10 @@ private:
   std::vector<std::unique_ptr<FunctionParserADBase<Output>>> dt_parsers;
   bool _valid_derivatives;
 
+  // JIT compilation settings
+  bool _jit;
+  bool _jit_cache;
+
   // Variables/values that can be parsed and handled by the function parser
   std::string variables;
   std::vector<std::string> _additional_vars;
@@ -202,6 +241,8 @@ ParsedFunction<Output,OutputGradient>::ParsedFunction (const std::string & expre
   // variables passed
   _spacetime (LIBMESH_DIM+1 + (additional_vars ? additional_vars->size() : 0)),
   _valid_derivatives (true),
+  _jit (false),
+  _jit_cache (false),
   _additional_vars (additional_vars ? *additional_vars : std::vector<std::string>()),
   _initial_vals (initial_vals ? *initial_vals : std::vector<Output>())
 {
@@ -219,6 +260,8 @@ ParsedFunction<Output,OutputGradient>::ParsedFunction (const ParsedFunction<Outp
   _subexpressions(other._subexpressions),
   _spacetime(other._spacetime),
   _valid_derivatives(other._valid_derivatives),
+  _jit(other._jit),
+  _jit_cache(other._jit_cache),
   variables(other.variables),
   _additional_vars(other._additional_vars),
   _initial_vals(other._initial_vals)
@@ -273,6 +316,16 @@ ParsedFunction<Output,OutputGradient>::reparse (const std::string & expression)
   this->_is_time_dependent = this->expression_is_time_dependent(expression);
 }
 
+template <typename Output, typename OutputGradient>
+inline
+void
+ParsedFunction<Output,OutputGradient>::enable_jit (bool use_cache)
+{
+  _jit = true;
+  _jit_cache = use_cache;
+  this->jit_compile();
+}
+
 template <typename Output, typename OutputGradient>
 inline
 Output
@@ -330,6 +383,23 @@ ParsedFunction<Output,OutputGradient>::operator()
     output(i) = eval(*parsers[i], "f", i);
 }
 
+template <typename Output, typename OutputGradient>
+inline
+void
+ParsedFunction<Output,OutputGradient>::operator()
+  (const std::vector<Point> & points,
+   const Real time,
+   std::vector<Output> & output)
+{
+  output.resize(points.size());
+
+  for (auto i : index_range(points))
+    {
+      set_spacetime(points[i], time);
+      output[i] = eval(*parsers[0], "f", 0);
+    }
+}
+
 /**
  * \returns The vector component \p i at coordinate
  * \p p and time \p time.
@@ -350,6 +420,26 @@ ParsedFunction<Output,OutputGradient>::component (unsigned int i,
   return eval(*parsers[i], "f", i);
 }
 
+template <typename Output, typename OutputGradient>
+inline
+void
+ParsedFunction<Output,OutputGradient>::component_values
+  (unsigned int i,
+   const std::vector<Point> & points,
+   const Real time,
+   std::vector<Output> & output)
+{
+  libmesh_assert_less (i, parsers.size());
+
+  output.resize(points.size());
+
+  for (auto j : index_range(points))
+    {
+      set_spacetime(points[j], time);
+      output[j] = eval(*parsers[i], "f", i);
+    }
+}
+
 /**
  * \returns The address of a parsed variable so you can supply a parameterized value
  */
@@ -374,9 +464,13 @@ inline
 std::unique_ptr<FunctionBase<Output>>
 ParsedFunction<Output,OutputGradient>::clone() const
 {
-  return libmesh_make_unique<ParsedFunction>(_expression,
-                                             &_additional_vars,
-                                             &_initial_vals);
+  auto new_func =
+    libmesh_make_unique<ParsedFunction>(_expression,
+                                        &_additional_vars,
+                                        &_initial_vals);
+  if (_jit)
+    new_func->enable_jit(_jit_cache);
+  return new_func;
 }
 
 template <typename Output, typename OutputGradient>
@@ -606,6 +700,38 @@ ParsedFunction<Output,OutputGradient>::partial_reparse (const std::string & expr
       // Store fp for later use
       parsers.push_back(std::move(fp));
     }
+
+  this->jit_compile();
+}
+
+
+template <typename Output, typename OutputGradient>
+inline
+void
+ParsedFunction<Output,OutputGradient>::jit_compile ()
+{
+  if (!_jit)
+    return;
+
+  // A failed compilation leaves the parser on its bytecode
+  auto compile = [this](std::vector<std::unique_ptr<FunctionParserADBase<Output>>> & fps)
+    {
+      for (auto & fp : fps)
+        {
+          fp->SetADFlags(FunctionParserADBase<Output>::ADJITCache, _jit_cache);
+          fp->JITCompile();
+        }
+    };
+
+  compile(parsers);
+  compile(dx_parsers);
+#if LIBMESH_DIM > 1
+  compile(dy_parsers);
+#endif
+#if LIBMESH_DIM > 2
+  compile(dz_parsers);
+#endif
+  compile(dt_parsers);
 }
 
 
@@ -201,6 +201,12 @@ public:
 
   virtual numeric_index_type row_stop () const override;
 
+  /**
+   * \returns The memory PETSc reports for the local part of the
+   * matrix.
+   */
+  virtual std::size_t memory_usage () const override;
+
   virtual void set (const numeric_index_type i,
                     const numeric_index_type j,
                     const T value) override;
@@ -216,6 +222,10 @@ public:
   virtual void add_matrix (const DenseMatrix<T> & dm,
                            const std::vector<numeric_index_type> & dof_indices) override;
 
+  virtual void add_matrix (const std::vector<numeric_index_type> & rows,
+                           const std::vector<numeric_index_type> & cols,
+                           const std::vector<T> & values) override;
+
   virtual void add_block_matrix (const DenseMatrix<T> & dm,
                                  const std::vector<numeric_index_type> & brows,
                                  const std::vector<numeric_index_type> & bcols) override;
@@ -262,6 +272,19 @@ public:
 
   virtual bool closed() const override;
 
+  /**
+   * PETSc only allows concurrent calls into the same Mat if it was
+   * configured with thread safety.
+   */
+  virtual bool supports_concurrent_insertion() const override
+  {
+#ifdef PETSC_HAVE_THREADSAFETY
+    return true;
+#else
+    return false;
+#endif
+  }
+
   /**
    * If set to false, we don't delete the Mat on destruction and allow
    * instead for \p PETSc to manage it.
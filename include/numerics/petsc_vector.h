@@ -138,8 +138,25 @@ public:
 
   virtual void close () override;
 
+  virtual void begin_ghost_update () override;
+
+  virtual void end_ghost_update () override;
+
   virtual void clear () override;
 
+  /**
+   * PETSc only allows concurrent calls into the same Vec if it was
+   * configured with thread safety.
+   */
+  virtual bool supports_concurrent_insertion() const override
+  {
+#ifdef PETSC_HAVE_THREADSAFETY
+    return true;
+#else
+    return false;
+#endif
+  }
+
   virtual void zero () override;
 
   virtual std::unique_ptr<NumericVector<T>> zero_clone () const override;
@@ -340,6 +357,13 @@ public:
   Vec vec () const { libmesh_assert (_vec); return _vec; }
 
 
+protected:
+
+  virtual T * get_local_array (bool read_only,
+                               const typename NumericVector<T>::GhostIndexMap *& ghost_map) const override;
+
+  virtual void release_local_array (bool read_only) const override;
+
 private:
 
   /**
@@ -574,7 +598,9 @@ PetscVector<T>::PetscVector (Vec v,
   ierr = VecGetType(_vec, &ptype);
   LIBMESH_CHKERR(ierr);
 
-  if ((std::strcmp(ptype,VECSHARED) == 0) || (std::strcmp(ptype,VECMPI) == 0))
+  // Device vector types, e.g. VECMPICUDA, share the VECMPI prefix
+  if ((std::strcmp(ptype,VECSHARED) == 0) ||
+      (std::strncmp(ptype,VECMPI,std::strlen(VECMPI)) == 0))
     {
       ISLocalToGlobalMapping mapping;
       ierr = VecGetLocalToGlobalMapping(_vec, &mapping);
@@ -826,6 +852,47 @@ void PetscVector<T>::close ()
 
 
 
+template <typename T>
+inline
+void PetscVector<T>::begin_ghost_update ()
+{
+  parallel_object_only();
+
+  this->_restore_array();
+
+  VecAssemblyBeginEnd(this->comm(), _vec);
+
+  if (this->type() == GHOSTED)
+    {
+      PetscErrorCode ierr =
+        VecGhostUpdateBegin(_vec, INSERT_VALUES, SCATTER_FORWARD);
+      LIBMESH_CHKERR(ierr);
+    }
+}
+
+
+
+template <typename T>
+inline
+void PetscVector<T>::end_ghost_update ()
+{
+  parallel_object_only();
+
+  // Owned entries may have been read since begin_ghost_update()
+  this->_restore_array();
+
+  if (this->type() == GHOSTED)
+    {
+      PetscErrorCode ierr =
+        VecGhostUpdateEnd(_vec, INSERT_VALUES, SCATTER_FORWARD);
+      LIBMESH_CHKERR(ierr);
+    }
+
+  this->_is_closed = true;
+}
+
+
+
 template <typename T>
 inline
 void PetscVector<T>::clear ()
@@ -1208,6 +1275,32 @@ std::size_t PetscVector<T>::max_allowed_id () const
 }
 
 
+template <typename T>
+inline
+T * PetscVector<T>::get_local_array (bool read_only,
+                                     const typename NumericVector<T>::GhostIndexMap *& ghost_map) const
+{
+  this->_get_array(read_only);
+
+  ghost_map = (this->type() == GHOSTED) ? &_global_to_local_map : nullptr;
+
+  // A read only array is never written through by the ReadView
+  return read_only ? const_cast<T *>(_read_only_values) : _values;
+}
+
+
+
+template <typename T>
+inline
+void PetscVector<T>::release_local_array (bool read_only) const
+{
+  // Restoring a writable array lets PETSc know its values may have
+  // changed; read only arrays can stay in place, as after operator()
+  if (!read_only)
+    this->_restore_array();
+}
+
+
 
 #ifdef LIBMESH_HAVE_CXX11
 static_assert(sizeof(PetscInt) == sizeof(numeric_index_type),
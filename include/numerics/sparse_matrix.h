@@ -138,6 +138,16 @@ public:
   virtual bool need_full_sparsity_pattern() const
   { return false; }
 
+  /**
+   * \returns \p true if several threads may call add_matrix() at
+   * once, as long as no two of them add to the same entries.
+   *
+   * This is false unless the underlying library is known to be
+   * thread-safe; callers must otherwise serialize their insertions.
+   */
+  virtual bool supports_concurrent_insertion() const
+  { return false; }
+
   /**
    * Updates the matrix sparsity pattern. When your \p SparseMatrix<T>
    * implementation does not need this data, simply do not override
@@ -241,6 +251,14 @@ public:
    */
   virtual numeric_index_type row_stop () const = 0;
 
+  /**
+   * \returns The memory held by the local rows of the matrix.  By
+   * default this is estimated, as compressed sparse row storage, from
+   * the nonzero counts of the attached sparsity pattern, and is zero
+   * if there is none.
+   */
+  virtual std::size_t memory_usage () const;
+
   /**
    * Set the element \p (i,j) to \p value.  Throws an error if the
    * entry does not exist. Zero values can be "stored" in non-existent
@@ -274,6 +292,19 @@ public:
   virtual void add_matrix (const DenseMatrix<T> & dm,
                            const std::vector<numeric_index_type> & dof_indices) = 0;
 
+  /**
+   * Add \p values[k] to the element \p (rows[k],cols[k]) for every
+   * \p k.  This is useful for adding many element matrices, staged
+   * in coordinate (COO) format, in a single call.  Repeated
+   * \p (row,col) pairs are summed.
+   *
+   * The default implementation calls add() for each entry; derived
+   * classes should override it for efficiency.
+   */
+  virtual void add_matrix (const std::vector<numeric_index_type> & rows,
+                           const std::vector<numeric_index_type> & cols,
+                           const std::vector<T> & values);
+
   /**
    * Add the full matrix \p dm to the SparseMatrix.  This is useful
    * for adding an element matrix at assembly time.  The matrix is
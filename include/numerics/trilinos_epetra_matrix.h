@@ -146,6 +146,8 @@ public:
                     const numeric_index_type j,
                     const T value) override;
 
+  using SparseMatrix<T>::add_matrix;
+
   virtual void add_matrix (const DenseMatrix<T> & dm,
                            const std::vector<numeric_index_type> & rows,
                            const std::vector<numeric_index_type> & cols) override;
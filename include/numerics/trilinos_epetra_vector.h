@@ -266,6 +266,11 @@ public:
    */
   Epetra_Vector * vec () { libmesh_assert(_vec); return _vec; }
 
+protected:
+
+  virtual T * get_local_array (bool read_only,
+                               const typename NumericVector<T>::GhostIndexMap *& ghost_map) const override;
+
 private:
 
   /**
@@ -844,6 +849,18 @@ std::size_t EpetraVector<T>::max_allowed_id () const
 }
 
 
+template <typename T>
+inline
+T * EpetraVector<T>::get_local_array (bool /*read_only*/,
+                                      const typename NumericVector<T>::GhostIndexMap *& ghost_map) const
+{
+  libmesh_assert (this->initialized());
+
+  ghost_map = nullptr;
+  return _vec->Values();
+}
+
+
 
 // Trilinos only got serious about const in version 10.4
 inline
@@ -1191,12 +1191,21 @@ inline
 TypeVector<typename CompareTypes<T,T2>::supertype>
 TypeTensor<T>::operator * (const TypeVector<T2> & p) const
 {
+#if LIBMESH_DIM == 3
+  // Unrolled, so each row is an independent dot product rather than
+  // a chain of updates to a zero-initialized result.
+  return TypeVector<typename CompareTypes<T,T2>::supertype>
+    (_coords[0]*p(0) + _coords[1]*p(1) + _coords[2]*p(2),
+     _coords[3]*p(0) + _coords[4]*p(1) + _coords[5]*p(2),
+     _coords[6]*p(0) + _coords[7]*p(1) + _coords[8]*p(2));
+#else
   TypeVector<typename CompareTypes<T,T2>::supertype> returnval;
   for (unsigned int i=0; i<LIBMESH_DIM; i++)
     for (unsigned int j=0; j<LIBMESH_DIM; j++)
       returnval(i) += (*this)(i,j)*p(j);
 
   return returnval;
+#endif
 }
 
 template <typename T>
@@ -1205,12 +1214,19 @@ inline
 TypeVector<typename CompareTypes<T,T2>::supertype>
 TypeTensor<T>::left_multiply (const TypeVector<T2> & p) const
 {
+#if LIBMESH_DIM == 3
+  return TypeVector<typename CompareTypes<T,T2>::supertype>
+    (p(0)*_coords[0] + p(1)*_coords[3] + p(2)*_coords[6],
+     p(0)*_coords[1] + p(1)*_coords[4] + p(2)*_coords[7],
+     p(0)*_coords[2] + p(1)*_coords[5] + p(2)*_coords[8]);
+#else
   TypeVector<typename CompareTypes<T,T2>::supertype> returnval;
   for (unsigned int i=0; i<LIBMESH_DIM; i++)
     for (unsigned int j=0; j<LIBMESH_DIM; j++)
       returnval(i) += p(j)*(*this)(j,i);
 
   return returnval;
+#endif
 }
 
 template <typename T, typename T2>
@@ -1228,10 +1244,16 @@ TypeTensor<typename CompareTypes<T, T2>::supertype>
 TypeTensor<T>::operator * (const TypeTensor<T2> & p) const
 {
   TypeTensor<typename CompareTypes<T, T2>::supertype> returnval;
+
+  // Row i of the product is a combination of the rows of p, which
+  // are contiguous, so the inner loop over j vectorizes.
   for (unsigned int i=0; i<LIBMESH_DIM; i++)
-    for (unsigned int j=0; j<LIBMESH_DIM; j++)
-      for (unsigned int k=0; k<LIBMESH_DIM; k++)
-        returnval(i,j) += (*this)(i,k)*p(k,j);
+    for (unsigned int k=0; k<LIBMESH_DIM; k++)
+      {
+        const T a_ik = _coords[i*LIBMESH_DIM+k];
+        for (unsigned int j=0; j<LIBMESH_DIM; j++)
+          returnval._coords[i*LIBMESH_DIM+j] += a_ik*p._coords[k*LIBMESH_DIM+j];
+      }
 
   return returnval;
 }
@@ -1243,9 +1265,12 @@ const TypeTensor<T> & TypeTensor<T>::operator *= (const TypeTensor<T2> & p)
 {
   TypeTensor<T> temp;
   for (unsigned int i=0; i<LIBMESH_DIM; i++)
-    for (unsigned int j=0; j<LIBMESH_DIM; j++)
-      for (unsigned int k=0; k<LIBMESH_DIM; k++)
-        temp(i,j) += (*this)(i,k)*p(k,j);
+    for (unsigned int k=0; k<LIBMESH_DIM; k++)
+      {
+        const T a_ik = _coords[i*LIBMESH_DIM+k];
+        for (unsigned int j=0; j<LIBMESH_DIM; j++)
+          temp._coords[i*LIBMESH_DIM+j] += a_ik*p._coords[k*LIBMESH_DIM+j];
+      }
 
   this->assign(temp);
   return *this;
@@ -1262,10 +1287,17 @@ inline
 typename CompareTypes<T,T2>::supertype
 TypeTensor<T>::contract (const TypeTensor<T2> & t) const
 {
+#if LIBMESH_DIM == 3
+  // Three independent row sums rather than one nine-long chain
+  return (_coords[0]*t._coords[0] + _coords[1]*t._coords[1] + _coords[2]*t._coords[2]) +
+         (_coords[3]*t._coords[3] + _coords[4]*t._coords[4] + _coords[5]*t._coords[5]) +
+         (_coords[6]*t._coords[6] + _coords[7]*t._coords[7] + _coords[8]*t._coords[8]);
+#else
   typename CompareTypes<T,T2>::supertype sum = 0.;
   for (unsigned int i=0; i<LIBMESH_DIM*LIBMESH_DIM; i++)
     sum += _coords[i]*t._coords[i];
   return sum;
+#endif
 }
 
 
@@ -30,6 +30,16 @@
 #include <cmath>
 #include <complex>
 
+// With --enable-padded-type-vector, three dimensional vectors are
+// stored with a fourth, always zero, entry, so that an array of them
+// has a power of two stride and the lane-wise operations below fill
+// a full 4-wide SIMD register.
+#if LIBMESH_DIM == 3 && defined(LIBMESH_ENABLE_PADDED_TYPE_VECTOR)
+#define LIBMESH_TYPE_VECTOR_STORAGE 4
+#else
+#define LIBMESH_TYPE_VECTOR_STORAGE LIBMESH_DIM
+#endif
+
 #ifdef LIBMESH_HAVE_EIGEN
 #include "libmesh/ignore_warnings.h"
 #include "Eigen/Core"
@@ -441,9 +451,13 @@ public:
 protected:
 
   /**
-   * The coordinates of the \p TypeVector.
+   * The coordinates of the \p TypeVector, followed by a zero entry
+   * when the storage is padded.
    */
-  T _coords[LIBMESH_DIM];
+#if LIBMESH_TYPE_VECTOR_STORAGE > LIBMESH_DIM && defined(__cpp_aligned_new)
+  alignas(LIBMESH_TYPE_VECTOR_STORAGE*sizeof(T))
+#endif
+  T _coords[LIBMESH_TYPE_VECTOR_STORAGE];
 };
 
 
@@ -466,6 +480,10 @@ TypeVector<T>::TypeVector ()
 #if LIBMESH_DIM > 2
   _coords[2] = {};
 #endif
+
+#if LIBMESH_TYPE_VECTOR_STORAGE > LIBMESH_DIM
+  _coords[LIBMESH_DIM] = {};
+#endif
 }
 
 
@@ -491,6 +509,10 @@ TypeVector<T>::TypeVector (const T & x,
   libmesh_ignore(z);
   libmesh_assert_equal_to (z, 0);
 #endif
+
+#if LIBMESH_TYPE_VECTOR_STORAGE > LIBMESH_DIM
+  _coords[LIBMESH_DIM] = {};
+#endif
 }
 
 
@@ -520,6 +542,10 @@ TypeVector<T>::TypeVector (typename
 #else
   libmesh_assert_equal_to (z, 0);
 #endif
+
+#if LIBMESH_TYPE_VECTOR_STORAGE > LIBMESH_DIM
+  _coords[LIBMESH_DIM] = {};
+#endif
 }
 
 
@@ -541,6 +567,10 @@ TypeVector<T>::TypeVector (const Scalar & x,
 #if LIBMESH_DIM > 2
   _coords[2] = 0;
 #endif
+
+#if LIBMESH_TYPE_VECTOR_STORAGE > LIBMESH_DIM
+  _coords[LIBMESH_DIM] = {};
+#endif
 }
 
 
@@ -551,7 +581,7 @@ inline
 TypeVector<T>::TypeVector (const TypeVector<T2> & p)
 {
   // copy the nodes from vector p to me
-  for (unsigned int i=0; i<LIBMESH_DIM; i++)
+  for (unsigned int i=0; i<LIBMESH_TYPE_VECTOR_STORAGE; i++)
     _coords[i] = p._coords[i];
 }
 
@@ -570,7 +600,7 @@ template <typename T2>
 inline
 void TypeVector<T>::assign (const TypeVector<T2> & p)
 {
-  for (unsigned int i=0; i<LIBMESH_DIM; i++)
+  for (unsigned int i=0; i<LIBMESH_TYPE_VECTOR_STORAGE; i++)
     _coords[i] = p._coords[i];
 }
 
@@ -654,6 +684,10 @@ void TypeVector<T>::add (const TypeVector<T2> & p)
   _coords[0] += p._coords[0];
   _coords[1] += p._coords[1];
   _coords[2] += p._coords[2];
+#if LIBMESH_TYPE_VECTOR_STORAGE > LIBMESH_DIM
+  // Updating the zero padding too lets this be one vector operation
+  _coords[3] += p._coords[3];
+#endif
 #endif
 
 }
@@ -678,6 +712,9 @@ void TypeVector<T>::add_scaled (const TypeVector<T2> & p, const T & factor)
   _coords[0] += factor*p(0);
   _coords[1] += factor*p(1);
   _coords[2] += factor*p(2);
+#if LIBMESH_TYPE_VECTOR_STORAGE > LIBMESH_DIM
+  _coords[3] += factor*p._coords[3];
+#endif
 #endif
 
 }
@@ -728,7 +765,7 @@ template <typename T2>
 inline
 void TypeVector<T>::subtract (const TypeVector<T2> & p)
 {
-  for (unsigned int i=0; i<LIBMESH_DIM; i++)
+  for (unsigned int i=0; i<LIBMESH_TYPE_VECTOR_STORAGE; i++)
     _coords[i] -= p._coords[i];
 }
 
@@ -739,8 +776,8 @@ template <typename T2>
 inline
 void TypeVector<T>::subtract_scaled (const TypeVector<T2> & p, const T & factor)
 {
-  for (unsigned int i=0; i<LIBMESH_DIM; i++)
-    _coords[i] -= factor*p(i);
+  for (unsigned int i=0; i<LIBMESH_TYPE_VECTOR_STORAGE; i++)
+    _coords[i] -= factor*p._coords[i];
 }
 
 
@@ -827,6 +864,9 @@ const TypeVector<T> & TypeVector<T>::operator *= (const T & factor)
   _coords[0] *= factor;
   _coords[1] *= factor;
   _coords[2] *= factor;
+#if LIBMESH_TYPE_VECTOR_STORAGE > LIBMESH_DIM
+  _coords[3] *= factor;
+#endif
 #endif
 
   return *this;
@@ -873,7 +913,7 @@ TypeVector<T>::operator /= (const T & factor)
 {
   libmesh_assert_not_equal_to (factor, static_cast<T>(0.));
 
-  for (unsigned int i=0; i<LIBMESH_DIM; i++)
+  for (unsigned int i=0; i<LIBMESH_TYPE_VECTOR_STORAGE; i++)
     _coords[i] /= factor;
 
   return *this;
@@ -917,6 +957,7 @@ TypeVector<T>::contract(const TypeVector<T2> & p) const
 
 template <typename T>
 template <typename T2>
+inline
 TypeVector<typename CompareTypes<T, T2>::supertype>
 TypeVector<T>::cross(const TypeVector<T2> & p) const
 {
@@ -952,7 +993,7 @@ template <typename T>
 inline
 void TypeVector<T>::zero()
 {
-  for (unsigned int i=0; i<LIBMESH_DIM; i++)
+  for (unsigned int i=0; i<LIBMESH_TYPE_VECTOR_STORAGE; i++)
     _coords[i] = 0.;
 }
 
@@ -983,8 +1024,8 @@ template <typename T>
 inline
 bool TypeVector<T>::is_zero() const
 {
-  for (const auto & val : _coords)
-    if (val != T(0))
+  for (unsigned int i=0; i<LIBMESH_DIM; i++)
+    if (_coords[i] != T(0))
       return false;
   return true;
 }
@@ -0,0 +1,214 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_COMM_LOG_H
+#define LIBMESH_COMM_LOG_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+
+// C++ includes
+#include <chrono>
+#include <cstddef>
+#include <map>
+#include <string>
+
+namespace libMesh
+{
+
+namespace Parallel
+{
+
+/**
+ * The \p CommLog class records how much communication each
+ * instrumented libMesh call site does: how often it is called, how
+ * many messages and bytes it sends and receives, and how long it
+ * takes, including the time spent waiting on other processors.
+ *
+ * Call sites are identified by pointers to string literals, as in
+ * PerfLog::fast_push().  Byte counts are sizeof() the entries
+ * exchanged, and so underestimate variable-size data.
+ *
+ * Recording is off by default, and costs one branch per call site
+ * when off.  It is enabled by the \p --log-communication command
+ * line option, and the resulting table is printed after the
+ * performance log.  Only the main thread should record.
+ *
+ * \brief Responsible for summarizing communication per call site.
+ */
+class CommLog
+{
+public:
+
+  /**
+   * The data recorded for each call site.
+   */
+  struct SiteData
+  {
+    unsigned int calls = 0;
+    std::size_t messages_sent = 0;
+    std::size_t bytes_sent = 0;
+    std::size_t messages_received = 0;
+    std::size_t bytes_received = 0;
+    double time = 0.;
+  };
+
+  CommLog() : _enabled(false) {}
+
+  void enable() { _enabled = true; }
+  void disable() { _enabled = false; }
+  bool enabled() const { return _enabled; }
+
+  /**
+   * Records \p n_messages messages totalling \p n_bytes bytes sent
+   * from \p site.
+   */
+  void record_send (const char * site,
+                    std::size_t n_messages,
+                    std::size_t n_bytes)
+  {
+    if (_enabled)
+      {
+        SiteData & data = _log[site];
+        data.messages_sent += n_messages;
+        data.bytes_sent += n_bytes;
+      }
+  }
+
+  /**
+   * Records each nonempty vector in \p map, a map from processor ids
+   * to vectors of data, as one message sent from \p site.
+   */
+  template <typename Map>
+  void record_sends (const char * site,
+                     const Map & map)
+  {
+    if (_enabled)
+      for (const auto & pr : map)
+        if (!pr.second.empty())
+          this->record_send(site, 1, pr.second.size() *
+                            sizeof(typename Map::mapped_type::value_type));
+  }
+
+  /**
+   * Records \p n_messages messages totalling \p n_bytes bytes
+   * received at \p site.
+   */
+  void record_receive (const char * site,
+                       std::size_t n_messages,
+                       std::size_t n_bytes)
+  {
+    if (_enabled)
+      {
+        SiteData & data = _log[site];
+        data.messages_received += n_messages;
+        data.bytes_received += n_bytes;
+      }
+  }
+
+  /**
+   * Records one call of \p site taking \p seconds.
+   */
+  void record_call (const char * site,
+                    double seconds)
+  {
+    if (_enabled)
+      {
+        SiteData & data = _log[site];
+        data.calls++;
+        data.time += seconds;
+      }
+  }
+
+  /**
+   * \returns The data recorded for \p site, which need not be the
+   * same pointer as was recorded.
+   */
+  SiteData get_site_data (const std::string & site) const;
+
+  /**
+   * \returns A table of the data recorded for each call site.
+   */
+  std::string get_log() const;
+
+  /**
+   * Prints the table, if anything has been recorded.
+   */
+  void print_log() const;
+
+  /**
+   * Forgets everything recorded.
+   */
+  void clear() { _log.clear(); }
+
+private:
+
+  /**
+   * \returns The data recorded, combined by call site name.
+   */
+  std::map<std::string, SiteData> summary() const;
+
+  bool _enabled;
+
+  std::map<const char *, SiteData> _log;
+};
+
+
+/**
+ * The communication log for the library's own call sites.
+ */
+extern CommLog comm_log;
+
+
+/**
+ * Records one call of a call site in \p comm_log, timed from
+ * construction to destruction.
+ */
+class CommLogScope
+{
+public:
+  explicit CommLogScope (const char * site) :
+    _site(site),
+    _enabled(comm_log.enabled())
+  {
+    if (_enabled)
+      _start = std::chrono::steady_clock::now();
+  }
+
+  ~CommLogScope()
+  {
+    if (_enabled)
+      {
+        const std::chrono::duration<double> elapsed =
+          std::chrono::steady_clock::now() - _start;
+        comm_log.record_call(_site, elapsed.count());
+      }
+  }
+
+private:
+  const char * _site;
+  const bool _enabled;
+  std::chrono::steady_clock::time_point _start;
+};
+
+} // namespace Parallel
+
+} // namespace libMesh
+
+#endif // LIBMESH_COMM_LOG_H
@@ -21,6 +21,7 @@
 #define LIBMESH_PARALLEL_GHOST_SYNC_H
 
 // libMesh includes
+#include "libmesh/comm_log.h"
 #include "libmesh/elem.h"
 #include "libmesh/int_range.h"
 #include "libmesh/location_maps.h"
@@ -106,6 +107,36 @@ void sync_dofobject_data_by_id(const Communicator & comm,
                                const DofObjectCheckFunctor & dofobj_check,
                                SyncFunctor &    sync);
 
+/**
+ * Fills \p requested_objs_id with the ids of the ghost dofobjects in
+ * a range, sorted by the processor which owns them, for use in later
+ * calls to the sync_dofobject_data_by_id() overload below.
+ *
+ * Elements within the range can be excluded from the request by
+ * returning false from dofobj_check(dof_object)
+ */
+template <typename Iterator,
+          typename DofObjectCheckFunctor>
+void build_dofobject_requests
+  (const Communicator & comm,
+   const Iterator & range_begin,
+   const Iterator & range_end,
+   const DofObjectCheckFunctor & dofobj_check,
+   std::map<processor_id_type, std::vector<dof_id_type>> & requested_objs_id);
+
+/**
+ * Request data about ghost dofobjects by id, as above, from
+ * pre-built request lists.  Code which syncs data on the same ghost
+ * objects many times can build the requests once and skip the
+ * iteration over the range on every subsequent exchange; the lists
+ * remain valid until the mesh ghosting or partitioning changes.
+ */
+template <typename SyncFunctor>
+void sync_dofobject_data_by_id
+  (const Communicator & comm,
+   const std::map<processor_id_type, std::vector<dof_id_type>> & requested_objs_id,
+   SyncFunctor & sync);
+
 //------------------------------------------------------------------------
 /**
  * Request data about a range of ghost elements uniquely
@@ -244,6 +275,9 @@ void sync_dofobject_data_by_xyz(const Communicator & comm,
   // This function must be run on all processors at once
   libmesh_parallel_only(comm);
 
+  static const char * const site = "sync_dofobject_data_by_xyz()";
+  CommLogScope log_scope(site);
+
   // We need a valid location_map
 #ifdef DEBUG
   bool need_map_update = (range_begin != range_end && location_map.empty());
@@ -326,6 +360,9 @@ void sync_dofobject_data_by_xyz(const Communicator & comm,
 
       // Gather whatever data the user wants
       sync.gather_data(query_id, data);
+
+      comm_log.record_receive(site, 1, pts.size() * sizeof(Point));
+      comm_log.record_send(site, 1, data.size() * sizeof(typename SyncFunctor::datum));
     };
 
   auto action_functor =
@@ -338,10 +375,14 @@ void sync_dofobject_data_by_xyz(const Communicator & comm,
       const processor_id_type query_pid =
         requested_objs_pt_inv[&point_request];
 
+      comm_log.record_receive(site, 1, data.size() * sizeof(typename SyncFunctor::datum));
+
       // Let the user process the results
       sync.act_on_data(requested_objs_id[query_pid], data);
     };
 
+  comm_log.record_sends(site, requested_objs_pt);
+
   // Trade requests with other processors
   typename SyncFunctor::datum * ex = nullptr;
   pull_parallel_vector_data
@@ -372,6 +413,29 @@ void sync_dofobject_data_by_id(const Communicator & comm,
   // This function must be run on all processors at once
   libmesh_parallel_only(comm);
 
+  // Request sets to send to each processor
+  std::map<processor_id_type, std::vector<dof_id_type>>
+    requested_objs_id;
+
+  build_dofobject_requests(comm, range_begin, range_end, dofobj_check,
+                           requested_objs_id);
+
+  sync_dofobject_data_by_id(comm, requested_objs_id, sync);
+}
+
+
+
+template <typename Iterator,
+          typename DofObjectCheckFunctor>
+void build_dofobject_requests
+  (const Communicator & comm,
+   const Iterator & range_begin,
+   const Iterator & range_end,
+   const DofObjectCheckFunctor & dofobj_check,
+   std::map<processor_id_type, std::vector<dof_id_type>> & requested_objs_id)
+{
+  requested_objs_id.clear();
+
   // Count the objects to ask each processor about
   std::map<processor_id_type, dof_id_type>
     ghost_objects_from_proc;
@@ -391,10 +455,6 @@ void sync_dofobject_data_by_id(const Communicator & comm,
         ghost_objects_from_proc[obj_procid]++;
     }
 
-  // Request sets to send to each processor
-  std::map<processor_id_type, std::vector<dof_id_type>>
-    requested_objs_id;
-
   // We know how many objects live on each processor, so reserve()
   // space for each.
   for (auto pair : ghost_objects_from_proc)
@@ -418,6 +478,21 @@ void sync_dofobject_data_by_id(const Communicator & comm,
 
       requested_objs_id[obj_procid].push_back(obj->id());
     }
+}
+
+
+
+template <typename SyncFunctor>
+void sync_dofobject_data_by_id
+  (const Communicator & comm,
+   const std::map<processor_id_type, std::vector<dof_id_type>> & requested_objs_id,
+   SyncFunctor & sync)
+{
+  // This function must be run on all processors at once
+  libmesh_parallel_only(comm);
+
+  static const char * const site = "sync_dofobject_data_by_id()";
+  CommLogScope log_scope(site);
 
   auto gather_functor =
     [&sync]
@@ -425,6 +500,9 @@ void sync_dofobject_data_by_id(const Communicator & comm,
      std::vector<typename SyncFunctor::datum> & data)
     {
       sync.gather_data(ids, data);
+
+      comm_log.record_receive(site, 1, ids.size() * sizeof(dof_id_type));
+      comm_log.record_send(site, 1, data.size() * sizeof(typename SyncFunctor::datum));
     };
 
   auto action_functor =
@@ -432,10 +510,14 @@ void sync_dofobject_data_by_id(const Communicator & comm,
     (processor_id_type, const std::vector<dof_id_type> & ids,
      const std::vector<typename SyncFunctor::datum> & data)
     {
+      comm_log.record_receive(site, 1, data.size() * sizeof(typename SyncFunctor::datum));
+
       // Let the user process the results
       sync.act_on_data(ids, data);
     };
 
+  comm_log.record_sends(site, requested_objs_id);
+
   // Trade requests with other processors
   typename SyncFunctor::datum * ex = nullptr;
   pull_parallel_vector_data
@@ -458,6 +540,9 @@ void sync_element_data_by_parent_id(MeshBase &       mesh,
   // This function must be run on all processors at once
   libmesh_parallel_only(comm);
 
+  static const char * const site = "sync_element_data_by_parent_id()";
+  CommLogScope log_scope(site);
+
   // Count the objects to ask each processor about
   std::map<processor_id_type, dof_id_type>
     ghost_objects_from_proc;
@@ -536,6 +621,9 @@ void sync_element_data_by_parent_id(MeshBase &       mesh,
 
       // Gather whatever data the user wants
       sync.gather_data(query_id, data);
+
+      comm_log.record_receive(site, 1, query_size * sizeof(parent_id_child_num[0]));
+      comm_log.record_send(site, 1, data.size() * sizeof(typename SyncFunctor::datum));
     };
 
   auto action_functor =
@@ -549,10 +637,14 @@ void sync_element_data_by_parent_id(MeshBase &       mesh,
       const processor_id_type query_pid =
         requested_objs_parent_id_child_num_inv[&parent_id_child_num_request];
 
+      comm_log.record_receive(site, 1, data.size() * sizeof(typename SyncFunctor::datum));
+
       // Let the user process the results
       sync.act_on_data(requested_objs_id[query_pid], data);
     };
 
+  comm_log.record_sends(site, requested_objs_parent_id_child_num);
+
   // Trade requests with other processors
   typename SyncFunctor::datum * ex = nullptr;
   pull_parallel_vector_data
@@ -584,6 +676,8 @@ bool sync_node_data_by_element_id_once(MeshBase & mesh,
 {
   const Communicator & comm (mesh.comm());
 
+  static const char * const site = "sync_node_data_by_element_id()";
+
   // Count the objects to ask each processor about
   std::map<processor_id_type, dof_id_type>
     ghost_objects_from_proc;
@@ -728,6 +822,9 @@ bool sync_node_data_by_element_id_once(MeshBase & mesh,
 
       // Gather whatever data the user wants
       sync.gather_data(query_id, data);
+
+      comm_log.record_receive(site, 1, request_size * sizeof(elem_id_node_num[0]));
+      comm_log.record_send(site, 1, data.size() * sizeof(typename SyncFunctor::datum));
     };
 
   bool data_changed = false;
@@ -742,6 +839,8 @@ bool sync_node_data_by_element_id_once(MeshBase & mesh,
 
       libmesh_assert_equal_to(elem_id_node_num.size(), data_size);
 
+      comm_log.record_receive(site, 1, data_size * sizeof(typename SyncFunctor::datum));
+
       std::vector<dof_id_type> requested_objs_id(data.size());
 
       for (auto i : IntRange<std::size_t>(0,data_size))
@@ -759,6 +858,8 @@ bool sync_node_data_by_element_id_once(MeshBase & mesh,
         data_changed = true;
     };
 
+  comm_log.record_sends(site, requested_objs_elem_id_node_num);
+
   // Trade requests with other processors
   typename SyncFunctor::datum * ex = nullptr;
   pull_parallel_vector_data
@@ -785,6 +886,8 @@ void sync_node_data_by_element_id(MeshBase & mesh,
   // This function must be run on all processors at once
   libmesh_parallel_only(mesh.comm());
 
+  CommLogScope log_scope("sync_node_data_by_element_id()");
+
   bool need_sync = false;
 
   do
@@ -55,6 +55,19 @@ template <typename KeyType, typename IdxType=unsigned int>
 class Sort : public ParallelObject
 {
 public:
+  /**
+   * The ways the data can be split into bins, one per processor.
+   *
+   * BIN_SORT splits the range between the global minimum and
+   * maximum keys with a histogram, which can leave one processor
+   * with most of the keys when they are clustered.
+   *
+   * SAMPLE_SORT picks the bin boundaries from a sample of the keys,
+   * sampling more of them until no bin is much larger than average.
+   * It is the default.
+   */
+  enum SortMethod { BIN_SORT, SAMPLE_SORT };
+
   /**
    * Constructor takes the number of processors,
    * the processor id, and a reference to a vector of data
@@ -64,7 +77,8 @@ public:
    * where n is the length of the vector.
    */
   Sort (const Parallel::Communicator & comm,
-        std::vector<KeyType> & d);
+        std::vector<KeyType> & d,
+        SortMethod method = SAMPLE_SORT);
 
 
   /**
@@ -94,6 +108,11 @@ private:
    */
   const processor_id_type _proc_id;
 
+  /**
+   * How the data is split into bins.
+   */
+  const SortMethod _method;
+
   /**
    * Flag which lets you know if sorting is complete
    */
@@ -128,6 +147,15 @@ private:
    */
   void binsort ();
 
+  /**
+   * Sorts the local data into bins across all processors, with bin
+   * boundaries chosen from a sample of the \p global_data_size keys.
+   * The sample is enlarged until the largest bin is within 10% of
+   * the average size; a small enough data set is sampled entirely,
+   * which makes the boundaries exact.
+   */
+  void samplesort (IdxType global_data_size);
+
   /**
    * Communicates the bins from each processor to the
    * appropriate processor.  By the time this function
@@ -24,8 +24,9 @@
 #include "libmesh/libmesh_common.h"  // for libmesh_assert
 
 
-// Compile-time check: TBB and pthreads are now mutually exclusive.
-#if defined(LIBMESH_HAVE_TBB_API) && defined(LIBMESH_HAVE_PTHREAD)
+// Compile-time check: TBB and pthreads, or TBB and OpenMP threads,
+// are now mutually exclusive.
+#if defined(LIBMESH_HAVE_TBB_API) && (defined(LIBMESH_HAVE_PTHREAD) || defined(LIBMESH_USING_OPENMP_THREADS))
 MULTIPLE THREADING MODELS CANNOT BE SIMULTANEOUSLY ACTIVE
 #endif
 
@@ -46,6 +47,23 @@ namespace Threads
  */
 extern bool in_threads;
 
+/**
+ * A boolean which is true if storage which threaded loops work on,
+ * such as \p DistributedVector values and \p DofObject index
+ * buffers, should be first touched from threaded loops too, so that
+ * on NUMA systems it is placed near the threads which use it.  Set
+ * by the --parallel-first-touch command line option.
+ */
+extern bool parallel_first_touch;
+
+/**
+ * A boolean which is true if the threads of the pthread thread
+ * model's pool should each be pinned to one of the CPUs the process
+ * may run on.  Set by the --pin-threads command line option.  Other
+ * thread models leave pinning to TBB or to OMP_PROC_BIND.
+ */
+extern bool pin_threads;
+
 /**
  * We use a class to turn Threads::in_threads on and off, to be
  * exception-safe.
@@ -100,6 +118,8 @@ public:
 #define LIBMESH_SQUASH_HEADER_WARNING
 #ifdef LIBMESH_HAVE_TBB_API
 # include "libmesh/threads_tbb.h"
+#elif defined(LIBMESH_USING_OPENMP_THREADS)
+# include "libmesh/threads_openmp.h"
 #elif LIBMESH_HAVE_PTHREAD
 # include "libmesh/threads_pthread.h"
 #else
@@ -168,6 +188,18 @@ public:
     _grainsize(r._grainsize)
   {}
 
+  /**
+   * Constructs the subrange [first,last) of \p r, with the same
+   * grainsize.
+   */
+  BlockedRange (const BlockedRange<T> & r,
+                const const_iterator first,
+                const const_iterator last):
+    _end(last),
+    _begin(first),
+    _grainsize(r._grainsize)
+  {}
+
   /**
    * Splits the range \p r.  The first half
    * of the range is left in place, the second
@@ -33,6 +33,8 @@
 // C++ includes
 #include <memory> // for std::allocator
 #include <cstddef> // std::ptrdiff_t
+#include <new> // placement new
+#include <utility> // std::forward
 
 namespace libMesh
 {
@@ -123,6 +125,48 @@ public:
 
 #endif // #ifdef LIBMESH_HAVE_TBB_API
 
+
+
+//-------------------------------------------------------------------
+/**
+ * Allocator which default-initializes rather than value-initializes
+ * the elements a container creates without a value, e.g. in
+ * std::vector::resize().  Values of trivially constructible types are
+ * thus left unwritten, so the memory pages holding them are first
+ * touched, and on NUMA systems placed, by whichever threads fill them
+ * in afterwards.
+ */
+template <typename T>
+class first_touch_allocator : public std::allocator<T>
+{
+public:
+  typedef T value_type;
+
+  template<typename U>
+  struct rebind
+  {
+    typedef first_touch_allocator<U> other;
+  };
+
+  first_touch_allocator () :
+    std::allocator<T>() {}
+
+  first_touch_allocator (const first_touch_allocator & a) :
+    std::allocator<T>(a) {}
+
+  template<typename U>
+  first_touch_allocator(const first_touch_allocator<U> & a) :
+    std::allocator<T>(a) {}
+
+  template <typename U>
+  void construct (U * p)
+  { ::new(static_cast<void *>(p)) U; }
+
+  template <typename U, typename... Args>
+  void construct (U * p, Args &&... args)
+  { ::new(static_cast<void *>(p)) U(std::forward<Args>(args)...); }
+};
+
 } // namespace Threads
 
 } // namespace libMesh
@@ -25,7 +25,7 @@
 # warning "This file is designed to be included through libmesh/threads.h"
 #else
 
-#if !defined(LIBMESH_HAVE_TBB_API) && !defined(LIBMESH_HAVE_PTHREAD)
+#if !defined(LIBMESH_HAVE_TBB_API) && !defined(LIBMESH_HAVE_PTHREAD) && !defined(LIBMESH_USING_OPENMP_THREADS)
 
 // Thread-Local-Storage macros
 #define LIBMESH_TLS_TYPE(type)  type
@@ -182,7 +182,7 @@ private:
 
 } // namespace libMesh
 
-#endif // !defined(LIBMESH_HAVE_TBB_API) && !defined(LIBMESH_HAVE_PTHREAD)
+#endif // !defined(LIBMESH_HAVE_TBB_API) && !defined(LIBMESH_HAVE_PTHREAD) && !defined(LIBMESH_USING_OPENMP_THREADS)
 
 #endif // LIBMESH_SQUASH_HEADER_WARNING
 
@@ -0,0 +1,422 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+#ifndef LIBMESH_THREADS_OPENMP_H
+#define LIBMESH_THREADS_OPENMP_H
+
+// Do not try to #include this header directly, it is designed to be
+// #included directly by threads.h
+#ifndef LIBMESH_SQUASH_HEADER_WARNING
+# warning "This file is designed to be included through libmesh/threads.h"
+#else
+
+#ifdef LIBMESH_USING_OPENMP_THREADS
+
+// C++ includes
+#ifdef LIBMESH_HAVE_CXX11_THREAD
+# include <thread>
+#endif
+
+#include "libmesh/libmesh_logging.h"
+#include <omp.h>
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <vector>
+
+// Thread-Local-Storage macros
+#ifdef LIBMESH_HAVE_CXX11_THREAD
+#  define LIBMESH_TLS_TYPE(type)  thread_local type
+#  define LIBMESH_TLS_REF(value)  (value)
+#else
+#  define LIBMESH_TLS_TYPE(type)  type
+#  define LIBMESH_TLS_REF(value)  (value)
+#endif
+
+namespace libMesh
+{
+
+namespace Threads
+{
+
+
+#ifdef LIBMESH_HAVE_CXX11_THREAD
+/**
+ * Use std::thread when available.
+ */
+typedef std::thread Thread;
+
+#else
+
+/**
+ * Use the non-concurrent placeholder.
+ */
+typedef NonConcurrentThread Thread;
+
+#endif // LIBMESH_HAVE_CXX11_THREAD
+
+
+/**
+ * Spin mutex.  Implemented with an OpenMP lock, which the OpenMP
+ * runtime may implement by spinning, yielding, or both, according to
+ * the application's OMP_WAIT_POLICY.
+ */
+class spin_mutex
+{
+public:
+  spin_mutex() { omp_init_lock(&slock); }
+  ~spin_mutex() { omp_destroy_lock(&slock); }
+
+  void lock () { omp_set_lock(&slock); }
+  void unlock () { omp_unset_lock(&slock); }
+
+  class scoped_lock
+  {
+  public:
+    scoped_lock () : smutex(nullptr) {}
+    explicit scoped_lock ( spin_mutex & in_smutex ) : smutex(&in_smutex) { smutex->lock(); }
+
+    ~scoped_lock () { release(); }
+
+    void acquire ( spin_mutex & in_smutex ) { smutex = &in_smutex; smutex->lock(); }
+    void release () { if (smutex) smutex->unlock(); smutex = nullptr; }
+
+  private:
+    spin_mutex * smutex;
+  };
+
+private:
+  omp_lock_t slock;
+};
+
+
+
+/**
+ * Recursive mutex.  Implemented with an OpenMP nestable lock.
+ */
+class recursive_mutex
+{
+public:
+  recursive_mutex() { omp_init_nest_lock(&rlock); }
+  ~recursive_mutex() { omp_destroy_nest_lock(&rlock); }
+
+  void lock () { omp_set_nest_lock(&rlock); }
+  void unlock () { omp_unset_nest_lock(&rlock); }
+
+  class scoped_lock
+  {
+  public:
+    scoped_lock () : rmutex(nullptr) {}
+    explicit scoped_lock ( recursive_mutex & in_rmutex ) : rmutex(&in_rmutex) { rmutex->lock(); }
+
+    ~scoped_lock () { release(); }
+
+    void acquire ( recursive_mutex & in_rmutex ) { rmutex = &in_rmutex; rmutex->lock(); }
+    void release () { if (rmutex) rmutex->unlock(); rmutex = nullptr; }
+
+  private:
+    recursive_mutex * rmutex;
+  };
+
+private:
+  omp_nest_lock_t rlock;
+};
+
+template <typename Range>
+int num_omp_threads(Range & range)
+{
+  std::size_t min = std::min((std::size_t)libMesh::n_threads(), (std::size_t)range.size());
+  return min > 0 ? cast_int<int>(min) : 1;
+}
+
+/**
+ * Scheduler to manage threads.  The OpenMP runtime owns the thread
+ * team, whose size and affinity are left to the application and its
+ * environment, so there is nothing to do here.
+ */
+class task_scheduler_init
+{
+public:
+  static const int automatic = -1;
+  explicit task_scheduler_init (int = automatic) {}
+  void initialize (int = automatic) {}
+  void terminate () {}
+};
+
+//-------------------------------------------------------------------
+/**
+ * Dummy "splitting object" used to distinguish splitting constructors
+ * from copy constructors.
+ */
+class split {};
+
+
+
+/**
+ * Calls \p body on each grainsize chunk of \p range, from whichever
+ * thread of the current OpenMP team is free next, for load balancing.
+ * Must be called from within an OpenMP parallel region.  The first
+ * exception \p body throws is stored in \p exception, and sets
+ * \p failed so that no further chunks are started.
+ */
+template <typename Range, typename Body>
+inline
+void run_chunks (const Range & range, Body & body,
+                 std::atomic<bool> & failed,
+                 std::exception_ptr & exception)
+{
+  const std::size_t size = range.size();
+  const std::size_t grainsize = std::max(std::size_t(range.grainsize()), std::size_t(1));
+
+  // The use of a signed type for the iteration variable is for
+  // OpenMP implementations predating OpenMP 3.0.
+  const long n_chunks = cast_int<long>((size + grainsize - 1) / grainsize);
+
+#pragma omp for schedule (dynamic)
+  for (long c=0; c<n_chunks; c++)
+    {
+      // Exceptions can't leave the parallel region, so we keep the
+      // first one for our caller to rethrow, and skip the remaining
+      // chunks
+      if (failed)
+        continue;
+
+      const std::size_t first = c * grainsize;
+      const std::size_t last = std::min(first + grainsize, size);
+      Range subrange(range, range.begin() + first, range.begin() + last);
+      try
+        {
+          body(subrange);
+        }
+      catch (...)
+        {
+#pragma omp critical (libmesh_run_chunks_exception)
+          if (!exception)
+            exception = std::current_exception();
+          failed = true;
+        }
+    }
+}
+
+
+
+//-------------------------------------------------------------------
+/**
+ * Execute the provided function object in parallel on the specified
+ * range.
+ */
+template <typename Range, typename Body>
+inline
+void parallel_for (const Range & range, const Body & body)
+{
+  Threads::BoolAcquire b(Threads::in_threads);
+
+  // If we're running in serial - just run!
+  if (libMesh::n_threads() == 1)
+  {
+    body(range);
+    return;
+  }
+
+#ifdef LIBMESH_ENABLE_PERFORMANCE_LOGGING
+  const bool logging_was_enabled = libMesh::perflog.logging_enabled();
+
+  if (libMesh::n_threads() > 1)
+    libMesh::perflog.disable_logging();
+#endif
+
+  const int n_threads = num_omp_threads(range);
+
+  std::atomic<bool> failed(false);
+  std::exception_ptr exception;
+
+#pragma omp parallel num_threads (n_threads)
+  run_chunks(range, body, failed, exception);
+
+#ifdef LIBMESH_ENABLE_PERFORMANCE_LOGGING
+  if (libMesh::n_threads() > 1 && logging_was_enabled)
+    libMesh::perflog.enable_logging();
+#endif
+
+  if (exception)
+    std::rethrow_exception(exception);
+}
+
+/**
+ * Execute the provided function object in parallel on the specified
+ * range with the specified partitioner.
+ */
+template <typename Range, typename Body, typename Partitioner>
+inline
+void parallel_for (const Range & range, const Body & body, const Partitioner &)
+{
+  parallel_for (range, body);
+}
+
+/**
+ * Execute the provided reduction operation in parallel on the specified
+ * range.
+ */
+template <typename Range, typename Body>
+inline
+void parallel_reduce (const Range & range, Body & body)
+{
+  Threads::BoolAcquire b(Threads::in_threads);
+
+  // If we're running in serial - just run!
+  if (libMesh::n_threads() == 1)
+  {
+    body(range);
+    return;
+  }
+
+#ifdef LIBMESH_ENABLE_PERFORMANCE_LOGGING
+  const bool logging_was_enabled = libMesh::perflog.logging_enabled();
+
+  if (libMesh::n_threads() > 1)
+    libMesh::perflog.disable_logging();
+#endif
+
+  const int n_threads = num_omp_threads(range);
+
+  // Create copies of the body for each thread
+  std::vector<Body *> bodies(n_threads);
+  bodies[0] = &body; // Use the original body for the first one
+  for (int i=1; i<n_threads; i++)
+    bodies[i] = new Body(body, Threads::split());
+
+  // The team may be smaller than requested, in which case some
+  // copies are just joined unused
+  std::atomic<bool> failed(false);
+  std::exception_ptr exception;
+
+#pragma omp parallel num_threads (n_threads)
+  run_chunks(range, *bodies[omp_get_thread_num()], failed, exception);
+
+  // Join them all down to the original Body, unless the reduction
+  // failed part way through
+  if (!exception)
+    for (int i=n_threads-1; i != 0; i--)
+      bodies[i-1]->join(*bodies[i]);
+
+  // Clean up
+  for (int i=1; i<n_threads; i++)
+    delete bodies[i];
+
+#ifdef LIBMESH_ENABLE_PERFORMANCE_LOGGING
+  if (libMesh::n_threads() > 1 && logging_was_enabled)
+    libMesh::perflog.enable_logging();
+#endif
+
+  if (exception)
+    std::rethrow_exception(exception);
+}
+
+/**
+ * Execute the provided reduction operation in parallel on the specified
+ * range with the specified partitioner.
+ */
+template <typename Range, typename Body, typename Partitioner>
+inline
+void parallel_reduce (const Range & range, Body & body, const Partitioner &)
+{
+  parallel_reduce(range, body);
+}
+
+
+/**
+ * Defines atomic operations which can only be executed on a
+ * single thread at a time.
+ */
+template <typename T>
+class atomic
+{
+public:
+  atomic () : val(0) {}
+  operator T () { return val; }
+
+  T operator=( T value )
+  {
+    spin_mutex::scoped_lock lock(smutex);
+    val = value;
+    return val;
+  }
+
+  atomic<T> & operator=( const atomic<T> & value )
+  {
+    spin_mutex::scoped_lock lock(smutex);
+    val = value;
+    return *this;
+  }
+
+
+  T operator+=(T value)
+  {
+    spin_mutex::scoped_lock lock(smutex);
+    val += value;
+    return val;
+  }
+
+  T operator-=(T value)
+  {
+    spin_mutex::scoped_lock lock(smutex);
+    val -= value;
+    return val;
+  }
+
+  T operator++()
+  {
+    spin_mutex::scoped_lock lock(smutex);
+    val++;
+    return val;
+  }
+
+  T operator++(int)
+  {
+    spin_mutex::scoped_lock lock(smutex);
+    val++;
+    return val;
+  }
+
+  T operator--()
+  {
+    spin_mutex::scoped_lock lock(smutex);
+    val--;
+    return val;
+  }
+
+  T operator--(int)
+  {
+    spin_mutex::scoped_lock lock(smutex);
+    val--;
+    return val;
+  }
+
+private:
+  T val;
+  spin_mutex smutex;
+};
+
+} // namespace Threads
+
+} // namespace libMesh
+
+#endif // #ifdef LIBMESH_USING_OPENMP_THREADS
+
+#endif // LIBMESH_SQUASH_HEADER_WARNING
+
+#endif // LIBMESH_THREADS_OPENMP_H
@@ -24,7 +24,7 @@
 # warning "This file is designed to be included through libmesh/threads.h"
 #else
 
-#ifdef LIBMESH_HAVE_PTHREAD
+#if defined(LIBMESH_HAVE_PTHREAD) && !defined(LIBMESH_USING_OPENMP_THREADS)
 
 // C++ includes
 #ifdef LIBMESH_HAVE_CXX11_THREAD
@@ -33,7 +33,13 @@
 
 #include "libmesh/libmesh_logging.h"
 #include <pthread.h>
+#include <sched.h>
 #include <algorithm>
+#include <atomic>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <utility>
 #include <vector>
 
 #ifdef __APPLE__
@@ -213,16 +219,175 @@ private:
 template <typename Range>
 unsigned int num_pthreads(Range & range)
 {
-  std::size_t min = std::min((std::size_t)libMesh::n_threads(), range.size());
+  std::size_t min = std::min((std::size_t)libMesh::n_threads(), (std::size_t)range.size());
   return min > 0 ? cast_int<unsigned int>(min) : 1;
 }
 
+/**
+ * Work-stealing scheduler for the subranges of a range.  Each worker
+ * starts with an equal share of the range in its own task queue.  A
+ * worker takes the newest task from its own queue and splits it in
+ * half, queueing the upper half, until it is no larger than the
+ * range's grainsize, then executes it; a worker whose queue is empty
+ * steals the oldest, and therefore largest, task from another
+ * worker.  Uneven work, e.g. from p-refined or mixed-type elements,
+ * is thus spread over all the threads as they become idle.
+ */
+template <typename Range>
+class RangeScheduler
+{
+public:
+  RangeScheduler (const Range & range, unsigned int n_workers) :
+    _range(range),
+    _size(range.size()),
+    _grainsize(std::max(std::size_t(range.grainsize()), std::size_t(1))),
+    _queues(n_workers),
+    _n_done(0),
+    _failed(false)
+  {
+    const std::size_t share = _size / n_workers;
+
+    std::size_t first = 0;
+    for (unsigned int i=0; i<n_workers; i++)
+      {
+        // Give the last one the remaining work to do
+        const std::size_t last = (i+1 == n_workers) ? _size : first + share;
+        if (last > first)
+          _queues[i].tasks.emplace_back(first, last);
+        first = last;
+      }
+  }
+
+  /**
+   * Executes tasks on behalf of \p worker, with \p body, until the
+   * whole range is done or some task has thrown an exception.
+   */
+  template <typename Body>
+  void run (unsigned int worker, Body & body)
+  {
+    Task task;
+    while (_n_done < _size && !_failed)
+      {
+        if (!this->pop(worker, task) && !this->steal(worker, task))
+          {
+            // Other workers are still busy with the last tasks
+            sched_yield();
+            continue;
+          }
+
+        while (task.second - task.first > _grainsize)
+          {
+            const std::size_t middle = task.first + (task.second - task.first)/2;
+            this->push(worker, Task(middle, task.second));
+            task.second = middle;
+          }
+
+        Range subrange(_range, _range.begin() + task.first, _range.begin() + task.second);
+        try
+          {
+            body(subrange);
+          }
+        catch (...)
+          {
+            // Keep the first exception, and stop every worker, since
+            // the range can no longer be finished
+            spin_mutex::scoped_lock lock(_exception_mutex);
+            if (!_exception)
+              _exception = std::current_exception();
+            _failed = true;
+            return;
+          }
+
+        _n_done += task.second - task.first;
+      }
+  }
+
+  /**
+   * \returns \p true if some task threw an exception.
+   */
+  bool failed () const { return _failed; }
+
+  /**
+   * Rethrows the first exception a task threw, if any.  Call this
+   * once every worker has returned from run().
+   */
+  void rethrow_exception () const
+  {
+    if (_exception)
+      std::rethrow_exception(_exception);
+  }
+
+private:
+  /**
+   * Offsets of the start and end of a subrange
+   */
+  typedef std::pair<std::size_t, std::size_t> Task;
+
+  struct TaskQueue
+  {
+    spin_mutex mutex;
+    std::deque<Task> tasks;
+  };
+
+  void push (unsigned int worker, const Task & task)
+  {
+    spin_mutex::scoped_lock lock(_queues[worker].mutex);
+    _queues[worker].tasks.push_back(task);
+  }
+
+  bool pop (unsigned int worker, Task & task)
+  {
+    spin_mutex::scoped_lock lock(_queues[worker].mutex);
+    std::deque<Task> & tasks = _queues[worker].tasks;
+    if (tasks.empty())
+      return false;
+    task = tasks.back();
+    tasks.pop_back();
+    return true;
+  }
+
+  bool steal (unsigned int worker, Task & task)
+  {
+    const std::size_t n_workers = _queues.size();
+    for (std::size_t i=1; i<n_workers; i++)
+      {
+        TaskQueue & victim = _queues[(worker + i) % n_workers];
+        spin_mutex::scoped_lock lock(victim.mutex);
+        if (!victim.tasks.empty())
+          {
+            task = victim.tasks.front();
+            victim.tasks.pop_front();
+            return true;
+          }
+      }
+    return false;
+  }
+
+  const Range & _range;
+  const std::size_t _size;
+  const std::size_t _grainsize;
+  std::vector<TaskQueue> _queues;
+
+  /**
+   * The number of range entries which have been executed
+   */
+  std::atomic<std::size_t> _n_done;
+
+  /**
+   * Whether some task threw, and the first exception thrown
+   */
+  std::atomic<bool> _failed;
+  spin_mutex _exception_mutex;
+  std::exception_ptr _exception;
+};
+
 template <typename Range, typename Body>
 class RangeBody
 {
 public:
-  Range * range;
+  RangeScheduler<Range> * scheduler;
   Body * body;
+  unsigned int worker;
 };
 
 template <typename Range, typename Body>
@@ -230,26 +395,172 @@ void * run_body(void * args)
 {
   RangeBody<Range, Body> * range_body = (RangeBody<Range, Body> *)args;
 
-  Body & body = *range_body->body;
-  Range & range = *range_body->range;
-
-  body(range);
+  range_body->scheduler->run(range_body->worker, *range_body->body);
 
   return nullptr;
 }
 
 /**
- * Scheduler to manage threads.
+ * A pool of threads which persist between parallel_for and
+ * parallel_reduce calls, so that loops too short to amortize
+ * creating threads still run in parallel efficiently.  The thread
+ * calling run() does the first job itself, so a pool for \p n_threads
+ * jobs holds \p n_threads - 1 threads, which wait for work between
+ * calls.
+ *
+ * The pool is created by \p task_scheduler_init, i.e. by
+ * \p LibMeshInit, and is not used with OpenMP, whose runtime keeps
+ * its own threads.
+ */
+class ThreadPool
+{
+public:
+  explicit ThreadPool (unsigned int n_threads);
+
+  ~ThreadPool ();
+
+  ThreadPool (const ThreadPool &) = delete;
+  ThreadPool & operator= (const ThreadPool &) = delete;
+
+  /**
+   * \returns The number of jobs the pool can run at once.
+   */
+  unsigned int n_threads () const { return cast_int<unsigned int>(_threads.size() + 1); }
+
+  /**
+   * Runs \p job(i) for each i < \p n_jobs concurrently, and returns
+   * when they are all done.  If any job throws, the others are still
+   * waited for, the pool is left ready for the next run, and the
+   * first exception caught is rethrown.
+   *
+   * \returns \p false, without running anything, if there are more
+   * jobs than threads or the pool is already running jobs, e.g. from
+   * a nested loop.
+   */
+  bool run (const std::function<void (unsigned int)> & job,
+            unsigned int n_jobs);
+
+  /**
+   * \returns The pool created by \p task_scheduler_init, or nullptr
+   * if there is none.
+   */
+  static ThreadPool * instance () { return _instance; }
+
+private:
+  friend class task_scheduler_init;
+
+  static void * work (void * args);
+
+  void work_loop (unsigned int worker);
+
+  /**
+   * Pins the calling thread and each of \p _threads to a different
+   * CPU, if possible, for Threads::pin_threads.
+   */
+  void pin ();
+
+  std::vector<pthread_t> _threads;
+
+  /**
+   * The pool and job index passed to each of \p _threads
+   */
+  std::vector<std::pair<ThreadPool *, unsigned int>> _thread_args;
+
+  pthread_mutex_t _mutex;
+  pthread_cond_t _work_cond;
+  pthread_cond_t _done_cond;
+
+  /**
+   * The jobs of the current run
+   */
+  const std::function<void (unsigned int)> * _job;
+  unsigned int _n_jobs;
+
+  /**
+   * Counts runs, so waiting threads can tell a new one has started
+   */
+  unsigned long _generation;
+
+  /**
+   * The number of pool threads still working on the current run
+   */
+  unsigned int _n_running;
+
+  /**
+   * The first exception thrown by a pool thread's job in the current
+   * run
+   */
+  std::exception_ptr _exception;
+
+  bool _busy;
+  bool _stop;
+
+  static ThreadPool * _instance;
+};
+
+/**
+ * Scheduler to manage threads.  Creates the \p ThreadPool which
+ * parallel_for and parallel_reduce use, unless there already is one.
  */
 class task_scheduler_init
 {
 public:
   static const int automatic = -1;
-  explicit task_scheduler_init (int = automatic) {}
-  void initialize (int = automatic) {}
-  void terminate () {}
+  explicit task_scheduler_init (int n_threads = automatic) :
+    _pool(nullptr)
+  { this->initialize(n_threads); }
+  ~task_scheduler_init () { this->terminate(); }
+  void initialize (int n_threads = automatic);
+  void terminate ();
+
+private:
+  /**
+   * The pool this object created, if any
+   */
+  ThreadPool * _pool;
 };
 
+/**
+ * Runs \p run_body on each of \p range_bodies concurrently, on the
+ * \p ThreadPool if possible and otherwise on new threads.
+ */
+template <typename Range, typename Body>
+void run_bodies (std::vector<RangeBody<Range, Body>> & range_bodies)
+{
+  const unsigned int n_threads = cast_int<unsigned int>(range_bodies.size());
+
+  // It may seem redundant to wrap a pragma in #ifdefs... but GCC
+  // warns about an "unknown pragma" if it encounters this line of
+  // code when -fopenmp is not passed to the compiler.
+#ifdef LIBMESH_HAVE_OPENMP
+  // The use of 'int' instead of unsigned for the iteration variable
+  // is deliberate here.  This is an OpenMP loop, and some older
+  // compilers warn when you don't use int for the loop index.  The
+  // reason has to do with signed vs. unsigned integer overflow
+  // behavior and optimization.
+  // http://blog.llvm.org/2011/05/what-every-c-programmer-should-know.html
+#pragma omp parallel for schedule (static)
+  for (int i=0; i<static_cast<int>(n_threads); i++)
+    run_body<Range, Body>((void *)&range_bodies[i]);
+#else
+  ThreadPool * pool = ThreadPool::instance();
+  if (pool &&
+      pool->run([&range_bodies](unsigned int i)
+                { run_body<Range, Body>((void *)&range_bodies[i]); },
+                n_threads))
+    return;
+
+  // Create the threads
+  std::vector<pthread_t> threads(n_threads);
+  for (unsigned int i=0; i<n_threads; i++)
+    pthread_create(&threads[i], nullptr, &run_body<Range, Body>, (void *)&range_bodies[i]);
+
+  // Wait for them to finish
+  for (unsigned int i=0; i<n_threads; i++)
+    pthread_join(threads[i], nullptr);
+#endif
+}
+
 //-------------------------------------------------------------------
 /**
  * Dummy "splitting object" used to distinguish splitting constructors
@@ -286,71 +597,26 @@ void parallel_for (const Range & range, const Body & body)
 #endif
   unsigned int n_threads = num_pthreads(range);
 
-  std::vector<Range *> ranges(n_threads);
-  std::vector<RangeBody<const Range, const Body>> range_bodies(n_threads);
-  std::vector<pthread_t> threads(n_threads);
-
-  // Create the ranges for each thread
-  std::size_t range_size = range.size() / n_threads;
-
-  typename Range::const_iterator current_beginning = range.begin();
+  RangeScheduler<Range> scheduler(range, n_threads);
 
-  for (unsigned int i=0; i<n_threads; i++)
-    {
-      std::size_t this_range_size = range_size;
-
-      if (i+1 == n_threads)
-        this_range_size += range.size() % n_threads; // Give the last one the remaining work to do
-
-      ranges[i] = new Range(range, current_beginning, current_beginning + this_range_size);
-
-      current_beginning = current_beginning + this_range_size;
-    }
+  std::vector<RangeBody<Range, const Body>> range_bodies(n_threads);
 
   // Create the RangeBody arguments
   for (unsigned int i=0; i<n_threads; i++)
     {
-      range_bodies[i].range = ranges[i];
+      range_bodies[i].scheduler = &scheduler;
       range_bodies[i].body = &body;
+      range_bodies[i].worker = i;
     }
 
-  // Create the threads.  It may seem redundant to wrap a pragma in
-  // #ifdefs... but GCC warns about an "unknown pragma" if it
-  // encounters this line of code when -fopenmp is not passed to the
-  // compiler.
-#ifdef LIBMESH_HAVE_OPENMP
-#pragma omp parallel for schedule (static)
-#endif
-  for (unsigned int i=0; i<n_threads; i++)
-    {
-#if !LIBMESH_HAVE_OPENMP
-      pthread_create(&threads[i], nullptr, &run_body<Range, Body>, (void *)&range_bodies[i]);
-#else
-      run_body<Range, Body>((void *)&range_bodies[i]);
-#endif
-    }
-
-#if !LIBMESH_HAVE_OPENMP
-  // Wait for them to finish
-
-  // The use of 'int' instead of unsigned for the iteration variable
-  // is deliberate here.  This is an OpenMP loop, and some older
-  // compilers warn when you don't use int for the loop index.  The
-  // reason has to do with signed vs. unsigned integer overflow
-  // behavior and optimization.
-  // http://blog.llvm.org/2011/05/what-every-c-programmer-should-know.html
-  for (int i=0; i<static_cast<int>(n_threads); i++)
-    pthread_join(threads[i], nullptr);
-#endif
-
-  // Clean up
-  for (unsigned int i=0; i<n_threads; i++)
-    delete ranges[i];
+  run_bodies(range_bodies);
 
 #ifdef LIBMESH_ENABLE_PERFORMANCE_LOGGING
   if (libMesh::n_threads() > 1 && logging_was_enabled)
     libMesh::perflog.enable_logging();
 #endif
+
+  scheduler.rethrow_exception();
 }
 
 /**
@@ -390,7 +656,8 @@ void parallel_reduce (const Range & range, Body & body)
 
   unsigned int n_threads = num_pthreads(range);
 
-  std::vector<Range *> ranges(n_threads);
+  RangeScheduler<Range> scheduler(range, n_threads);
+
   std::vector<Body *> bodies(n_threads);
   std::vector<RangeBody<Range, Body>> range_bodies(n_threads);
 
@@ -399,74 +666,32 @@ void parallel_reduce (const Range & range, Body & body)
   for (unsigned int i=1; i<n_threads; i++)
     bodies[i] = new Body(body, Threads::split());
 
-  // Create the ranges for each thread
-  std::size_t range_size = range.size() / n_threads;
-
-  typename Range::const_iterator current_beginning = range.begin();
-
-  for (unsigned int i=0; i<n_threads; i++)
-    {
-      std::size_t this_range_size = range_size;
-
-      if (i+1 == n_threads)
-        this_range_size += range.size() % n_threads; // Give the last one the remaining work to do
-
-      ranges[i] = new Range(range, current_beginning, current_beginning + this_range_size);
-
-      current_beginning = current_beginning + this_range_size;
-    }
-
   // Create the RangeBody arguments
   for (unsigned int i=0; i<n_threads; i++)
     {
-      range_bodies[i].range = ranges[i];
+      range_bodies[i].scheduler = &scheduler;
       range_bodies[i].body = bodies[i];
+      range_bodies[i].worker = i;
     }
 
-  // Create the threads
-  std::vector<pthread_t> threads(n_threads);
-
-  // It may seem redundant to wrap a pragma in #ifdefs... but GCC
-  // warns about an "unknown pragma" if it encounters this line of
-  // code when -fopenmp is not passed to the compiler.
-#ifdef LIBMESH_HAVE_OPENMP
-#pragma omp parallel for schedule (static)
-#endif
-  // The use of 'int' instead of unsigned for the iteration variable
-  // is deliberate here.  This is an OpenMP loop, and some older
-  // compilers warn when you don't use int for the loop index.  The
-  // reason has to do with signed vs. unsigned integer overflow
-  // behavior and optimization.
-  // http://blog.llvm.org/2011/05/what-every-c-programmer-should-know.html
-  for (int i=0; i<static_cast<int>(n_threads); i++)
-    {
-#if !LIBMESH_HAVE_OPENMP
-      pthread_create(&threads[i], nullptr, &run_body<Range, Body>, (void *)&range_bodies[i]);
-#else
-      run_body<Range, Body>((void *)&range_bodies[i]);
-#endif
-    }
-
-#if !LIBMESH_HAVE_OPENMP
-  // Wait for them to finish
-  for (unsigned int i=0; i<n_threads; i++)
-    pthread_join(threads[i], nullptr);
-#endif
+  run_bodies(range_bodies);
 
-  // Join them all down to the original Body
-  for (unsigned int i=n_threads-1; i != 0; i--)
-    bodies[i-1]->join(*bodies[i]);
+  // Join them all down to the original Body, unless the reduction
+  // failed part way through
+  if (!scheduler.failed())
+    for (unsigned int i=n_threads-1; i != 0; i--)
+      bodies[i-1]->join(*bodies[i]);
 
   // Clean up
   for (unsigned int i=1; i<n_threads; i++)
     delete bodies[i];
-  for (unsigned int i=0; i<n_threads; i++)
-    delete ranges[i];
 
 #ifdef LIBMESH_ENABLE_PERFORMANCE_LOGGING
   if (libMesh::n_threads() > 1 && logging_was_enabled)
     libMesh::perflog.enable_logging();
 #endif
+
+  scheduler.rethrow_exception();
 }
 
 /**
@@ -558,7 +783,7 @@ private:
 
 } // namespace libMesh
 
-#endif // #ifdef LIBMESH_HAVE_PTHREAD
+#endif // LIBMESH_HAVE_PTHREAD && !LIBMESH_USING_OPENMP_THREADS
 
 #endif // LIBMESH_SQUASH_HEADER_WARNING
 
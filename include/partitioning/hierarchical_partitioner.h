@@ -0,0 +1,137 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+
+#ifndef LIBMESH_HIERARCHICAL_PARTITIONER_H
+#define LIBMESH_HIERARCHICAL_PARTITIONER_H
+
+// Local Includes
+#include "libmesh/partitioner.h"
+#include "libmesh/auto_ptr.h" // libmesh_make_unique
+
+// C++ Includes
+#include <vector>
+
+namespace libMesh
+{
+
+/**
+ * The \p HierarchicalPartitioner partitions the mesh in two levels.
+ * The elements are first partitioned into one part per compute node,
+ * and the elements of each of those parts are then partitioned among
+ * the processors on that node.  The edge cut between compute nodes
+ * is thus minimized first, and neighboring parts are kept on the
+ * same node wherever possible, so that more of the communication
+ * stays within a node.
+ *
+ * Processors are grouped into compute nodes using the MPI-3
+ * shared-memory communicator split, unless a fixed number of
+ * processors per node is given with set_processors_per_node().
+ *
+ * \note Every compute node must hold the same number of processors,
+ * otherwise the node-level parts would not be balanced; when they
+ * don't, or when there is only a single compute node, a flat
+ * partitioning is done by the internal Partitioner instead.
+ *
+ * \brief Partitions across compute nodes, then within each node.
+ */
+class HierarchicalPartitioner : public Partitioner
+{
+public:
+
+  /**
+   * Constructors. The default ctor initializes the internal
+   * Partitioner object to a MetisPartitioner so the class is usable,
+   * although this type can be customized later.
+   */
+  HierarchicalPartitioner ();
+  HierarchicalPartitioner (const HierarchicalPartitioner & other);
+
+  /**
+   * This class contains a unique_ptr member, so it can't be default
+   * copy assigned.
+   */
+  HierarchicalPartitioner & operator= (const HierarchicalPartitioner &) = delete;
+
+  /**
+   * Move ctor, move assignment operator, and destructor are
+   * all explicitly defaulted for this class.
+   */
+  HierarchicalPartitioner (HierarchicalPartitioner &&) = default;
+  HierarchicalPartitioner & operator= (HierarchicalPartitioner &&) = default;
+  virtual ~HierarchicalPartitioner() = default;
+
+  /**
+   * \returns A copy of this partitioner wrapped in a smart pointer.
+   */
+  virtual std::unique_ptr<Partitioner> clone () const override
+  {
+    return libmesh_make_unique<HierarchicalPartitioner>(*this);
+  }
+
+  /**
+   * Groups consecutive ranks into compute nodes of \p n_procs
+   * processors each, rather than detecting the compute nodes from
+   * the shared-memory communicator split.  Passing 0 restores the
+   * detection.
+   */
+  void set_processors_per_node (processor_id_type n_procs)
+  { _processors_per_node = n_procs; }
+
+  /**
+   * Get a reference to the Partitioner used internally, at both
+   * levels, by the HierarchicalPartitioner.
+   *
+   * \note The internal Partitioner cannot also be a
+   * HierarchicalPartitioner, otherwise an infinite loop will result.
+   */
+  std::unique_ptr<Partitioner> & internal_partitioner() { return _internal_partitioner; }
+
+protected:
+  /**
+   * The internal Partitioner we use. Public access via the
+   * internal_partitioner() member function.
+   */
+  std::unique_ptr<Partitioner> _internal_partitioner;
+
+  /**
+   * The number of processors per compute node, or 0 to detect the
+   * compute nodes.
+   */
+  processor_id_type _processors_per_node;
+
+  /**
+   * Partition the \p MeshBase into \p n subdomains.
+   */
+  virtual void _do_partition (MeshBase & mesh,
+                              const unsigned int n) override;
+
+private:
+  /**
+   * \returns The processors of each compute node, considering only
+   * the first \p n processors of the mesh communicator.
+   */
+  std::vector<std::vector<processor_id_type>>
+  node_processors (const MeshBase & mesh,
+                   const unsigned int n) const;
+};
+
+} // namespace libMesh
+
+#endif  // LIBMESH_HIERARCHICAL_PARTITIONER_H
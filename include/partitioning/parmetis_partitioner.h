@@ -81,6 +81,22 @@ public:
     return libmesh_make_unique<ParmetisPartitioner>(*this);
   }
 
+  /**
+   * Use the given element weights, indexed by element id, e.g. from
+   * Partitioner::predictive_weights(), instead of element node
+   * counts to define a balanced partitioning.
+   */
+  virtual void attach_weights(ErrorVector * weights) override { _weights = weights; }
+
+  /**
+   * Sets the ratio of interprocessor communication time to data
+   * redistribution time which ParMETIS trades off when
+   * repartitioning.  Small ratios, such as 0.001, favor diffusive
+   * repartitionings which move as few elements as possible from the
+   * current partitioning; the default, 1e6, favors a small edge cut.
+   */
+  void set_redistribution_ratio (Real ratio) { _redistribution_ratio = ratio; }
+
 
 protected:
 
@@ -99,6 +115,11 @@ protected:
   virtual void _do_partition (MeshBase & mesh,
                               const unsigned int n) override;
 
+  /**
+   * The ratio passed to ParMETIS as its "itr" parameter.
+   */
+  Real _redistribution_ratio;
+
 #ifdef LIBMESH_HAVE_PARMETIS
   /**
   * Build the graph.
@@ -54,7 +54,7 @@ public:
   /**
    * Constructor.
    */
-  Partitioner () : _weights(nullptr) {}
+  Partitioner () : _weights(nullptr), _n_migrated_elem(0) {}
 
   /**
    * Copy/move ctor, copy/move assignment operator, and destructor are
@@ -135,6 +135,9 @@ public:
    * algorithms can repartition more efficiently than computing a new
    * partitioning from scratch.)  The default behavior is to simply
    * call this->partition(mesh,n).
+   *
+   * The number of active elements this moves to a different
+   * processor is then available from n_migrated_elem().
    */
   void repartition (MeshBase & mesh,
                     const unsigned int n);
@@ -202,6 +205,31 @@ public:
    */
   virtual void attach_weights(ErrorVector * /*weights*/) { libmesh_not_implemented(); }
 
+  /**
+   * \returns The number of active elements which the last call to
+   * repartition() assigned to a different processor than they had
+   * been on, i.e. the amount of element data the new partitioning
+   * requires to be redistributed.
+   */
+  dof_id_type n_migrated_elem () const { return _n_migrated_elem; }
+
+  /**
+   * Fills \p weights, suitable for attach_weights(), with a
+   * prediction of the cost of each active element after the next
+   * adaptive refinement step: its number of nodes, times (p+1)^dim
+   * for its p level, times its number of children if its entry in
+   * \p error_per_cell exceeds \p refine_error.  This lets a
+   * repartitioning right after refinement anticipate the next one.
+   *
+   * \p error_per_cell is indexed by element id, as ErrorEstimator
+   * results are.  The resulting weights are the same on every
+   * processor, even on a distributed mesh.
+   */
+  static void predictive_weights (const MeshBase & mesh,
+                                  const ErrorVector & error_per_cell,
+                                  Real refine_error,
+                                  ErrorVector & weights);
+
 protected:
 
   /**
@@ -266,6 +294,11 @@ protected:
    */
   ErrorVector * _weights;
 
+  /**
+   * The number of active elements moved by the last repartition().
+   */
+  dof_id_type _n_migrated_elem;
+
   /**
    * Maps active element ids into a contiguous range, as needed by parallel partitioner.
    */
@@ -32,7 +32,16 @@ namespace libMesh
 
 /**
  * The \p SFCPartitioner uses a Hilbert or Morton-ordered space
- * filling curve to partition the elements.
+ * filling curve to partition the elements.  If weights are attached,
+ * the curve is cut into pieces of equal total weight rather than
+ * equal numbers of elements.
+ *
+ * A distributed mesh is partitioned without serializing it: each
+ * processor computes the Hilbert keys of the elements it owns, the
+ * keys are ordered with a parallel sort, and the weighted cut points
+ * are found from a distributed prefix sum.  This always uses a
+ * Hilbert curve and requires libHilbert; without it the mesh is
+ * gathered and partitioned serially.
  *
  * \author Benjamin S. Kirk
  * \date 2003
@@ -80,6 +89,12 @@ public:
     _sfc_type = sfc_type;
   }
 
+  /**
+   * Attaches weights, indexed by element id, to be balanced along the
+   * curve.
+   */
+  virtual void attach_weights(ErrorVector * weights) override { _weights = weights; }
+
   /**
    * Called by the SubdomainPartitioner to partition elements in the range (it, end).
    */
@@ -99,6 +114,15 @@ protected:
 
 private:
 
+  /**
+   * Partitions the elements in the range (it, end) of a distributed
+   * mesh without gathering it onto every processor.
+   */
+  void distributed_partition_range(MeshBase & mesh,
+                                   MeshBase::element_iterator it,
+                                   MeshBase::element_iterator end,
+                                   const unsigned int n);
+
   /**
    * The type of space-filling curve to use.  Hilbert by default.
    */
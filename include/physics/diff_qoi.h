@@ -117,7 +117,10 @@ public:
    * elem_qoi_derivative
    *
    * Only qois included in the supplied \p QoISet need their
-   * derivatives assembled.
+   * derivatives assembled.  Derivatives left zero on an element are
+   * skipped when the adjoint right hand sides are assembled, so QoIs
+   * supported on only a few elements, such as point probes, are
+   * cheap to assemble together.
    */
   virtual void element_qoi_derivative (DiffContext &,
                                        const QoISet &)
@@ -179,6 +179,11 @@ public:
   /**
    * Initializes the data structures for a quadrature rule for an
    * element of type \p type.
+   *
+   * Rules for which \p cache_rules() is true are computed once per
+   * process: later calls asking for the same rule, from any object of
+   * the same class, copy the points and weights computed the first
+   * time.
    */
   virtual void init (const ElemType type=INVALID_ELEM,
                      unsigned int p_level=0);
@@ -255,6 +260,20 @@ public:
 
 protected:
 
+  /**
+   * \returns \p true if the points and weights computed by the
+   * \p init_*D() functions depend only on the class, \p type(),
+   * dimension, order, element type, p-level and
+   * \p allow_rules_with_negative_weights, so that init() may reuse
+   * rules computed by other objects.  Defaults to \p false; the
+   * built-in rules which qualify override it.
+   */
+  virtual bool cache_rules() const { return false; }
+
+  /**
+   * Calls the \p init_*D() function for our dimension.
+   */
+  void init_rule ();
 
   /**
    * Initializes the 0D quadrature rule by filling the points and
@@ -31,6 +31,8 @@
 
 // C++ includes
 #include <memory>
+#include <unordered_map>
+#include <vector>
 
 namespace libMesh
 {
@@ -94,8 +96,58 @@ public:
                      const std::vector<Real> & vertex_distance_func,
                      unsigned int p_level=0) override;
 
+  /**
+   * \returns The coordinates of the current quadrature points in a
+   * flat, component-major layout: entry \p d*n_points()+qp is
+   * coordinate \p d of point \p qp, for \p d < LIBMESH_DIM.
+   */
+  const std::vector<Real> & get_coordinates () const
+  { return _coordinates; }
+
+  /**
+   * Forgets the composite rule saved for the cut element with id
+   * \p elem_id, e.g. after its geometry has changed.
+   */
+  void invalidate_cut (dof_id_type elem_id)
+  { _cut_cache.erase(elem_id); }
+
+  /**
+   * Forgets the composite rules saved for all cut elements.  This
+   * must be done whenever element ids are reassigned.
+   */
+  void clear_cut_cache ()
+  { _cut_cache.clear(); }
+
 private:
 
+  /**
+   * The composite rule for a cut element, and the element type, p
+   * level and vertex distance function values it was built for.
+   * Since the cutting is done on the reference element, the rule only
+   * depends on those.
+   */
+  struct CutRule
+  {
+    std::size_t hash;
+    ElemType type;
+    unsigned int p_level;
+    std::vector<Real> vertex_distance_func;
+    std::vector<Real> coordinates;
+    std::vector<Real> weights;
+  };
+
+  /**
+   * \returns A hash of the data a CutRule depends on.
+   */
+  static std::size_t cut_hash (ElemType type,
+                               unsigned int p_level,
+                               const std::vector<Real> & vertex_distance_func);
+
+  /**
+   * Fills \p _coordinates from \p _points.
+   */
+  void fill_coordinates ();
+
   /**
    * Helper function called from init() to collect all the points and
    * weights of the subelement quadrature rules.
@@ -116,6 +168,18 @@ private:
    * Lagrange FE to use for subcell mapping.
    */
   std::unique_ptr<FEBase> _lagrange_fe;
+
+  /**
+   * The quadrature point coordinates, component by component.
+   */
+  std::vector<Real> _coordinates;
+
+  /**
+   * The last composite rule built for each cut element, by element
+   * id, reused by init() while the element type, p level and vertex
+   * distance function values on that element are unchanged.
+   */
+  std::unordered_map<dof_id_type, CutRule> _cut_cache;
 };
 
 } // namespace libMesh
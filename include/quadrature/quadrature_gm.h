@@ -121,6 +121,14 @@ public:
   virtual QuadratureType type() const override;
 
 
+protected:
+
+  /**
+   * \returns \p true, since our rules depend only on the fields
+   * QBase::init() caches them by.
+   */
+  virtual bool cache_rules() const override;
+
 private:
 
   /**
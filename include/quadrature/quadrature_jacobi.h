@@ -81,6 +81,14 @@ public:
    */
   virtual QuadratureType type() const override;
 
+protected:
+
+  /**
+   * \returns \p true, since \p type() tells apart our values of
+   * alpha and beta, the only other state our rules depend on.
+   */
+  virtual bool cache_rules() const override;
+
 private:
   unsigned int _alpha;
   unsigned int _beta;
@@ -78,6 +78,15 @@ public:
    */
   virtual QuadratureType type() const override;
 
+protected:
+
+  /**
+   * \returns \p true for a \p QNodal itself, whose rules depend only
+   * on the fields QBase::init() caches them by, but \p false for
+   * derived classes, which may have other state.
+   */
+  virtual bool cache_rules() const override;
+
 private:
 
   virtual void init_1D (const ElemType, unsigned int) override;
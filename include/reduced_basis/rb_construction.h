@@ -197,6 +197,20 @@ public:
    */
   void train_reduced_basis_with_POD();
 
+  /**
+   * Train the reduced basis using POD, like train_reduced_basis_with_POD(),
+   * but without keeping every snapshot.  The truth solves are folded in
+   * batches of incremental_POD_batch_size into a set of at most Nmax
+   * POD modes, so memory use is bounded by roughly Nmax plus the batch
+   * size vectors, and only the inner products of each batch with the
+   * current modes and with itself are needed.
+   *
+   * Without truncation this gives the same basis as
+   * train_reduced_basis_with_POD(); with it, the modes are those of the
+   * truncated approximation of the snapshot set built so far.
+   */
+  void train_reduced_basis_with_incremental_POD();
+
   /**
    * (i) Compute the a posteriori error bound for each set of parameters
    * in the training set, (ii) set current_parameters to the parameters that
@@ -628,6 +642,13 @@ public:
    */
   bool use_empty_rb_solve_in_greedy;
 
+  /**
+   * The number of truth solves that train_reduced_basis_with_incremental_POD()
+   * folds into the POD modes at a time.  Larger batches mean fewer
+   * updates of the modes, but more snapshots held in memory at once.
+   */
+  unsigned int incremental_POD_batch_size;
+
   /**
    * A boolean flag to indicate whether or not the Fq representor norms
    * have already been computed --- used to make sure that we don't
@@ -947,6 +968,7 @@ private:
    * Options are:
    *  - Greedy: Reduced basis greedy algorithm
    *  - POD: Proper Orthogonal Decomposition
+   *  - IncrementalPOD: POD computed from batches of snapshots
    */
   std::string RB_training_type;
 
@@ -220,11 +220,23 @@ private:
   std::pair<Real, unsigned int> compute_max_eim_error();
 
   /**
-   * Compute the maximum (i.e. l-infinity norm) error of the best fit
-   * of the parametrized function at training index \p training_index
-   * into the EIM approximation space.
+   * Bring the cached best fit data up to date with the current EIM
+   * basis: append the value of each training sample's parametrized
+   * function at each new interpolation point and, for
+   * PROJECTION_BEST_FIT, its inner product with each new basis
+   * function.  This needs one reduction per new basis function,
+   * rather than one per training sample.
    */
-  Real compute_best_fit_error(unsigned int training_index);
+  void update_best_fit_data();
+
+  /**
+   * \returns The largest absolute value, over the elements local to
+   * this processor, of \p v minus the combination of the EIM basis
+   * functions with coefficients \p coeffs.  This neither modifies
+   * \p v nor communicates, so it may be called from multiple threads.
+   */
+  Real get_local_max_abs_residual(const QpDataMap & v,
+                                  const DenseVector<Number> & coeffs) const;
 
   /**
    * Compute and store the parametrized function for each
@@ -246,6 +258,12 @@ private:
    */
   Number inner_product(const QpDataMap & v, const QpDataMap & w);
 
+  /**
+   * The contribution of the elements local to this processor to
+   * inner_product(v, w).  This may be called from multiple threads.
+   */
+  Number local_inner_product(const QpDataMap & v, const QpDataMap & w) const;
+
   /**
    * Get the maximum absolute value from a vector stored in the format that we use
    * for basis functions.
@@ -262,15 +280,6 @@ private:
    */
   void update_eim_matrices();
 
-  /**
-   * We compute the best fit of parametrized_function
-   * into the EIM space and then evaluate the error
-   * in the norm defined by inner_product_matrix.
-   *
-   * \returns The error in the best fit
-   */
-  Real compute_best_fit_error();
-
   /**
    * Scale all values in \p pf by \p scaling_factor
    */
@@ -325,6 +334,17 @@ private:
    */
   Real _max_abs_value_in_training_set;
 
+  /**
+   * The data the best fit of each training sample needs, kept up to
+   * date by update_best_fit_data() so that the Greedy iterations do
+   * not recompute it:
+   *   training index --> interpolation point index --> value
+   *   training index --> basis function index --> inner product
+   * The inner products are only stored for PROJECTION_BEST_FIT.
+   */
+  std::vector<std::vector<Number>> _training_interpolation_values;
+  std::vector<std::vector<Number>> _training_basis_innerprods;
+
   /**
    * The quadrature point locations, quadrature point weights (JxW), and subdomain IDs
    * on every element local to this processor.
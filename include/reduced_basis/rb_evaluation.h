@@ -115,6 +115,24 @@ public:
   virtual Real rb_solve(unsigned int N,
                         const std::vector<Number> * evaluated_thetas);
 
+  /**
+   * Perform the online solve with the N RB basis functions for each
+   * of the parameters in \p mus.  The theta functions are evaluated
+   * at all of the parameters at once, and all of the reduced systems
+   * are assembled by a single matrix-matrix product, before each is
+   * solved in turn.
+   *
+   * On return, \p outputs[i] holds the RB outputs and
+   * \p error_bounds[i] the (absolute) error bound, or -1 if
+   * evaluate_RB_error_bound is false, for \p mus[i].  The current
+   * parameters and RB_solution are left at those of the last
+   * parameter in \p mus.
+   */
+  virtual void rb_solve_batch(unsigned int N,
+                              const std::vector<RBParameters> & mus,
+                              std::vector<std::vector<Number>> & outputs,
+                              std::vector<Real> & error_bounds);
+
   /**
    * \returns A scaling factor that we can use to provide a consistent
    * scaling of the RB error bound across different parameter values.
@@ -191,6 +209,27 @@ public:
                                                    bool read_error_bound_data=true,
                                                    const bool read_binary_data=true);
 
+  /**
+   * Write out all the Offline reduced basis data, except for the
+   * basis functions, to the single binary file \p file_name.  Every
+   * array is stored contiguously and aligned, so that the file can be
+   * memory-mapped and read back with one copy per array.  Only
+   * processor 0 writes.
+   *
+   * \note The file is only readable on machines with the same byte
+   * order and the same Real and Number types.
+   */
+  virtual void write_offline_data_to_binary_file(const std::string & file_name);
+
+  /**
+   * Read in Offline reduced basis data written by
+   * write_offline_data_to_binary_file(), to initialize the system for
+   * Online solves.  Where available, the file is memory-mapped
+   * read-only, so concurrent readers on a node share its pages.
+   */
+  virtual void read_offline_data_from_binary_file(const std::string & file_name,
+                                                  bool read_error_bound_data=true);
+
   /**
    * Write out all the basis functions to file.
    * \p sys is used for file IO
@@ -347,6 +386,18 @@ protected:
    */
   void assert_file_exists(const std::string & file_name);
 
+  /**
+   * Evaluate the RB outputs for the solution saved in RB_solution
+   * and, if evaluate_RB_error_bound is true, the error bounds.
+   * Shared by rb_solve() and rb_solve_batch().  If
+   * \p evaluated_output_thetas is given, it holds the output thetas
+   * at the current parameters, ordered by output and then by term.
+   * \returns The (absolute) error bound, or -1 if it was not computed.
+   */
+  Real evaluate_outputs_and_error_bounds(unsigned int N,
+                                         const std::vector<Number> * evaluated_thetas,
+                                         const std::vector<Number> * evaluated_output_thetas = nullptr);
+
 private:
 
   /**
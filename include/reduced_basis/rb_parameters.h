@@ -27,6 +27,7 @@
 #include <string>
 #include <map>
 #include <set>
+#include <vector>
 
 namespace libMesh
 {
@@ -88,6 +89,28 @@ public:
    */
   void set_value(const std::string & param_name, Real value);
 
+  /**
+   * \returns The position of \p param_name in the (alphabetical)
+   * order of the parameter names.  Positions only depend on the set
+   * of names, so a theta function evaluated many times can resolve
+   * the names it uses once, and then read the values of every
+   * RBParameters object with the same names by position with
+   * get_value_at().
+   */
+  unsigned int get_parameter_index(const std::string & param_name) const;
+
+  /**
+   * \returns The value of the parameter at position \p index, in
+   * constant time.
+   */
+  Real get_value_at(unsigned int index) const;
+
+  /**
+   * Get a const reference to the values of all the parameters, in
+   * the order of their names.
+   */
+  const std::vector<Real> & get_values() const;
+
   /**
    * Get the value of the specific extra parameter.
    */
@@ -177,6 +200,18 @@ private:
    */
   std::map<std::string, Real> _parameters;
 
+  /**
+   * The values in _parameters, in the same order, for access by
+   * position.
+   */
+  std::vector<Real> _values;
+
+  /**
+   * Refills _values after names are added to or removed from
+   * _parameters.
+   */
+  void update_values();
+
   /**
    * The map that stores extra parameters not used for RB training, indexed by names.
    */
@@ -32,6 +32,7 @@
 #include "libmesh/parallel_object.h"
 
 // C++ includes
+#include <vector>
 
 namespace libMesh
 {
@@ -84,6 +85,17 @@ public:
    */
   virtual Real get_SCM_UB();
 
+  /**
+   * Evaluate the SCM lower and upper bounds at each of the parameters
+   * in \p mus.  The theta functions are evaluated for all of \p mus
+   * at once, and since the lower bound LPs differ only in their
+   * objective, a single LP is assembled and then re-solved, starting
+   * from the previous optimal basis, for each parameter.
+   */
+  virtual void get_SCM_bounds(const std::vector<RBParameters> & mus,
+                              std::vector<Real> & LB,
+                              std::vector<Real> & UB);
+
   /**
    * Get stability constraints (i.e. the values of coercivity/
    * inf-sup/stability constants at the parameter values chosen
@@ -208,8 +220,13 @@ public:
 private:
 
   /**
-   * Vector in which to save a parameter set. Useful
-   * in get_SCM_LB, for example.
+   * \returns theta_q at each of \p mus, indexed by q and then by
+   * the index into \p mus.
+   */
+  std::vector<std::vector<Number>> eval_A_thetas(const std::vector<RBParameters> & mus);
+
+  /**
+   * Vector in which to save a parameter set.
    */
   RBParameters saved_parameters;
 
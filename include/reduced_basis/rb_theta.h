@@ -40,6 +40,12 @@ class RBParameters;
  * for the PDE decomposition employed by the Reduced
  * Basis method.
  *
+ * Thetas are evaluated for every online solve, so those which are
+ * expensive to evaluate should override evaluate_vec() to process
+ * many parameters at once, and can look up the positions of the
+ * parameters they use with RBParameters::get_parameter_index() once
+ * rather than looking up values by name in every evaluation.
+ *
  * \author David J. Knezevic
  * \date 2011
  */
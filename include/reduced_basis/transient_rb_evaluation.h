@@ -97,6 +97,27 @@ public:
    */
   virtual Real rb_solve_again();
 
+  /**
+   * Perform the online solve with the N RB basis functions for each
+   * of the parameters in \p mus.  \p outputs[i] holds the RB outputs
+   * at the final time step for \p mus[i].
+   *
+   * The error bounds need the whole time history, so if
+   * evaluate_RB_error_bound is true this simply performs rb_solve()
+   * for each parameter in turn.  Otherwise the theta functions are
+   * evaluated at all of the parameters at once, each reduced LHS is
+   * factored once, and only the final outputs are computed: no time
+   * histories are stored, \p error_bounds are -1, and RB_solution is
+   * left at the final time step for the last parameter.  When there
+   * are more time steps than basis functions, LHS^{-1} RHS and
+   * LHS^{-1} F are formed once per parameter, so that each time step
+   * is a single matrix-vector product.
+   */
+  virtual void rb_solve_batch(unsigned int N,
+                              const std::vector<RBParameters> & mus,
+                              std::vector<std::vector<Number>> & outputs,
+                              std::vector<Real> & error_bounds) override;
+
   /**
    * \returns A scaling factor that we can use to provide a consistent
    * scaling of the RB error bound across different parameter values.
@@ -160,6 +181,15 @@ public:
                                                    bool read_error_bound_data=true,
                                                    const bool read_binary_data=true) override;
 
+  /**
+   * The binary offline data format does not yet hold the
+   * time-dependent data, so these throw rather than silently
+   * dropping it.
+   */
+  virtual void write_offline_data_to_binary_file(const std::string & file_name) override;
+  virtual void read_offline_data_from_binary_file(const std::string & file_name,
+                                                  bool read_error_bound_data=true) override;
+
   //----------- PUBLIC DATA MEMBERS -----------//
 
   /**
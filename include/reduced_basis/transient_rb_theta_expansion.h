@@ -60,6 +60,12 @@ public:
   virtual Number eval_M_theta(unsigned int q,
                               const RBParameters & mu);
 
+  /**
+   * Evaluate theta_q_m at multiple parameters simultaneously.
+   */
+  virtual std::vector<Number> eval_M_theta(unsigned int q,
+                                           const std::vector<RBParameters> & mus);
+
   /**
    * Get Q_m, the number of terms in the affine
    * expansion for the mass operator.
@@ -24,6 +24,7 @@
 #include "libmesh/libmesh_config.h"
 #include "libmesh/libmesh_common.h"
 #include "libmesh/point.h"
+#include "libmesh/bounding_box.h"
 #include "libmesh/parallel_object.h"
 #ifdef LIBMESH_HAVE_NANOFLANN
 #  include "libmesh/ignore_warnings.h"
@@ -66,10 +67,18 @@ public:
    * from other processors, so all interpolation can be performed
    * locally.
    *
+   * DISTRIBUTED_SOURCES leaves the data added on each processor
+   * there.  Calling the \p prepare_for_use() method with this
+   * \p ParallelizationStrategy only shares the bounding box of each
+   * processor's sources; interpolation then becomes a collective
+   * operation, with each target point sent only to the processors
+   * whose sources might be among its nearest neighbors.
+   *
    * Other \p ParallelizationStrategy techniques will be implemented
    * as needed.
    */
-  enum ParallelizationStrategy {SYNC_SOURCES     = 0,
+  enum ParallelizationStrategy {SYNC_SOURCES        = 0,
+                                DISTRIBUTED_SOURCES = 1,
                                 INVALID_STRATEGY};
   /**
    * Constructor.
@@ -79,6 +88,19 @@ public:
     _parallelization_strategy (SYNC_SOURCES)
   {}
 
+  /**
+   * Sets the \p ParallelizationStrategy to employ.  This must be
+   * done before \p prepare_for_use() is called.
+   */
+  void set_parallelization_strategy (ParallelizationStrategy strategy)
+  { _parallelization_strategy = strategy; }
+
+  /**
+   * \returns The \p ParallelizationStrategy in use.
+   */
+  ParallelizationStrategy parallelization_strategy () const
+  { return _parallelization_strategy; }
+
   /**
    * Prints information about this object, by default to
    * libMesh::out.
@@ -164,10 +186,23 @@ protected:
    */
   virtual void gather_remote_data ();
 
+  /**
+   * Gathers the bounding box of the source points on each processor,
+   * for use with the \p DISTRIBUTED_SOURCES strategy.  Processors
+   * without source points have an invalid bounding box.
+   */
+  virtual void gather_source_bounding_boxes ();
+
   ParallelizationStrategy  _parallelization_strategy;
   std::vector<std::string> _names;
   std::vector<Point>       _src_pts;
   std::vector<Number>      _src_vals;
+
+  /**
+   * The bounding box of the source points on each processor, when
+   * using the \p DISTRIBUTED_SOURCES strategy.
+   */
+  std::vector<BoundingBox> _src_bboxes;
 };
 
 
@@ -314,6 +349,19 @@ protected:
                             const std::vector<Real>   & src_dist_sqr,
                             std::vector<Number>::iterator & out_it) const;
 
+  /**
+   * Interpolates at the target points using the sources on every
+   * processor, as required by the \p DISTRIBUTED_SOURCES strategy.
+   * Each target point is sent only to processors whose source
+   * bounding box lies closer than the farthest of its local nearest
+   * neighbors, so the result matches what \p SYNC_SOURCES would
+   * give without gathering the sources.
+   *
+   * This must be called on all processors at once.
+   */
+  void interpolate_from_distributed_sources (const std::vector<Point> & tgt_pts,
+                                             std::vector<Number> & tgt_vals) const;
+
   const Real         _half_power;
   const unsigned int _n_interp_pts;
 
@@ -20,17 +20,25 @@
 
 #include "libmesh/solution_transfer.h"
 
+#include <map>
+#include <memory>
 #include <string>
+#include <tuple>
+#include <vector>
 
 namespace libMesh
 {
 
+// Forward Declarations
+template <typename T> class SparseMatrix;
+
 /**
  * Implementation of a SolutionTransfer object that only works for
  * transferring the solution using a MeshFunction
  *
- * \note A serialization of the "from" solution vector will be
- * performed!  This can be slow in parallel and take a lot of memory!
+ * \note Unless transfer operators are cached, a serialization of the
+ * "from" solution vector will be performed, and the "from" mesh must
+ * be serial!  This can be slow in parallel and take a lot of memory!
  *
  * \author Derek Gaston
  * \date 2013
@@ -46,6 +54,60 @@ public:
    * Transfer the values of a variable to another.
    */
   virtual void transfer(const Variable & from_var, const Variable & to_var) override;
+
+  /**
+   * If \p cache is true, each transfer between a new pair of
+   * variables computes its interpolation weights into a sparse
+   * transfer operator, and later transfers between the same pair
+   * just apply that operator as a parallel matrix-vector product,
+   * without serializing the "from" solution or locating points.
+   *
+   * Cached operators also work when the "from" mesh is distributed:
+   * points outside the elements a processor has are sent to the
+   * processors whose local elements' bounding boxes contain them,
+   * which return their interpolation weights.  The resulting matrix
+   * then serves as the communication plan for every later transfer.
+   *
+   * An operator is rebuilt automatically if the number of DoFs or
+   * active elements on either side changes; call
+   * \p clear_transfer_operators() after any other mesh change, such
+   * as moving nodes.
+   */
+  void cache_transfer_operators (bool cache)
+  { _cache_operators = cache; }
+
+  /**
+   * Forget any cached transfer operators.
+   */
+  void clear_transfer_operators ();
+
+private:
+  /**
+   * The cached operator for transfers between one pair of variables,
+   * with what we need to tell whether it is still valid.
+   */
+  struct TransferOperator
+  {
+    dof_id_type from_n_dofs, to_n_dofs;
+    dof_id_type from_n_elem, to_n_elem;
+
+    // The local "to" DoFs we set, and the matrix giving their values
+    // from the "from" solution
+    std::vector<numeric_index_type> to_dofs;
+    std::unique_ptr<SparseMatrix<Number>> matrix;
+  };
+
+  /**
+   * Computes the transfer operator between two variables.
+   */
+  void build_transfer_operator (const Variable & from_var,
+                                const Variable & to_var,
+                                TransferOperator & op) const;
+
+  bool _cache_operators;
+
+  std::map<std::tuple<const System *, unsigned int, const System *, unsigned int>,
+           TransferOperator> _operators;
 };
 
 } // namespace libMesh
@@ -71,6 +71,17 @@ protected:
    */
   Real _r_override;
 
+  /**
+   * Whether to solve for the weights with a sparse LinearSolver.
+   */
+  bool _sparse_solve;
+
+  /**
+   * Computes \p _weights with a sparse \p LinearSolver solve, for
+   * \p set_sparse_solve().
+   */
+  void solve_sparse_weights (const RBF & rbf);
+
 public:
 
   /**
@@ -80,9 +91,24 @@ public:
                             Real radius=-1) :
     InverseDistanceInterpolation<KDDim> (comm_in,8,2),
     _r_bbox(0.),
-    _r_override(radius)
+    _r_override(radius),
+    _sparse_solve(false)
   { libmesh_experimental(); }
 
+  /**
+   * Assemble the interpolation matrix as a \p SparseMatrix, coupling
+   * only sources found within the RBF support radius of each other
+   * by a KD tree search, and solve for the weights with a
+   * \p LinearSolver instead of a dense Eigen factorization.  This is
+   * only worthwhile with a support radius much smaller than the
+   * source bounding box, so it should be combined with the
+   * \p radius constructor argument.
+   *
+   * Must be called before \p prepare_for_use().
+   */
+  void set_sparse_solve (bool sparse_solve)
+  { _sparse_solve = sparse_solve; }
+
   /**
    * Clears all internal data structures and restores to a
    * pristine state.
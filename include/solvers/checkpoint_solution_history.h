@@ -0,0 +1,210 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_CHECKPOINT_SOLUTION_HISTORY_H
+#define LIBMESH_CHECKPOINT_SOLUTION_HISTORY_H
+
+// Local includes
+#include "libmesh/numeric_vector.h"
+#include "libmesh/solution_history.h"
+#include "libmesh/auto_ptr.h" // libmesh_make_unique
+
+// C++ includes
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace libMesh
+{
+
+/**
+ * Subclass of Solution History that keeps the primal solution only
+ * at every \p checkpoint_interval th stored timestep, and recomputes
+ * the timesteps in between from the preceding checkpoint when they
+ * are retrieved.
+ *
+ * The timesteps recomputed for one retrieval are kept until a
+ * retrieval falls outside of their interval, so a backwards sweep
+ * through the history, as in an adjoint solve, recomputes each
+ * timestep only once.  With an interval of about the square root of
+ * the number of timesteps, this needs storage for twice that many
+ * solutions rather than for all of them, at the price of one extra
+ * forward solve.
+ *
+ * Stored vectors can optionally be zlib compressed, which is
+ * lossless, and/or rounded to single precision, which is not.
+ *
+ * Adjoint solutions stored during an adjoint sweep are kept at every
+ * timestep.
+ *
+ * Recomputation reruns the system's DiffSolver with the system's own
+ * time solver, which must be a first order UnsteadySolver, so that
+ * the old nonlinear solution is the only history it needs.
+ *
+ * \brief Stores past solutions at checkpoints, recomputing the rest.
+ */
+class CheckpointSolutionHistory : public SolutionHistory
+{
+public:
+
+  /**
+   * Constructor, reference to system to be passed by user.
+   */
+  CheckpointSolutionHistory(System & system_,
+                            unsigned int checkpoint_interval = 10);
+
+  /**
+   * Destructor
+   */
+  ~CheckpointSolutionHistory();
+
+  /**
+   * Virtual function store which we will be overriding to store timesteps
+   */
+  virtual void store(bool is_adjoint_solve, Real time) override;
+
+  /**
+   * Virtual function retrieve which we will be overriding to retrieve
+   * timesteps, recomputing them if necessary
+   */
+  virtual void retrieve(bool is_adjoint_solve, Real time) override;
+
+  /**
+   * Virtual function erase which we will be overriding to erase timesteps
+   */
+  virtual void erase(Real time) override;
+
+  /**
+   * Definition of the clone function needed for the setter function
+   */
+  virtual std::unique_ptr<SolutionHistory > clone() const override;
+
+  /**
+   * Turn on zlib compression of stored vectors.  This is ignored if
+   * libMesh was built without zlib.
+   */
+  void set_compression (bool val)
+  { _compress = val; }
+
+  /**
+   * Turn on rounding of stored vectors to single precision.
+   */
+  void set_single_precision (bool val)
+  { _single_precision = val; }
+
+  /**
+   * \returns The number of timesteps recomputed so far.
+   */
+  unsigned int n_recomputed_steps() const
+  { return _n_recomputed_steps; }
+
+private:
+
+  /**
+   * The local part of a saved vector, either as a copy of the vector
+   * itself or as a (possibly compressed) array of bytes
+   */
+  struct SavedVector
+  {
+    std::unique_ptr<NumericVector<Number>> vec;
+    std::vector<unsigned char> bytes;
+    std::size_t n_bytes = 0;
+    bool compressed = false;
+    bool single_precision = false;
+  };
+
+  typedef std::map<std::string, SavedVector> map_type;
+  typedef std::map<Real, map_type> map_map_type;
+
+  /**
+   * Saves \p vec into \p saved
+   */
+  void save_vector(const NumericVector<Number> & vec,
+                   SavedVector & saved) const;
+
+  /**
+   * Restores \p vec from \p saved
+   */
+  void restore_vector(const SavedVector & saved,
+                      NumericVector<Number> & vec) const;
+
+  /**
+   * Saves the solution and all projection-worthy system vectors
+   * into \p entry, except those already there unless \p overwrite
+   * is true, and except those in \p skip.
+   */
+  void save_system(map_type & entry,
+                   bool overwrite,
+                   const std::set<std::string> * skip) const;
+
+  /**
+   * Restores all the vectors in \p entry into the system
+   */
+  void restore_system(const map_type & entry) const;
+
+  /**
+   * \returns The entry in \p entries within TOLERANCE of \p time,
+   * or entries.end()
+   */
+  static map_map_type::iterator find_entry(map_map_type & entries, Real time);
+
+  /**
+   * \returns The index in _times within TOLERANCE of \p time, or
+   * _times.size()
+   */
+  std::size_t find_time(Real time) const;
+
+  /**
+   * Recomputes the primal solutions from the checkpoint preceding
+   * \p time up to \p time, keeping each in _recomputed.
+   */
+  void recompute(Real time);
+
+  // The times at which primal solutions were stored, in order
+  std::vector<Real> _times;
+
+  // The full primal solutions at every checkpoint_interval th time
+  map_map_type _checkpoints;
+
+  // The primal solutions recomputed by the last recompute()
+  map_map_type _recomputed;
+
+  // The adjoint solutions stored at each time
+  map_map_type _adjoints;
+
+  // The names of the vectors stored with primal solutions
+  std::set<std::string> _primal_vector_names;
+
+  // How many stored times there are per checkpoint
+  unsigned int _checkpoint_interval;
+
+  bool _compress;
+
+  bool _single_precision;
+
+  unsigned int _n_recomputed_steps;
+
+  // A system reference
+  System & _system;
+};
+
+} // end namespace libMesh
+
+#endif // LIBMESH_CHECKPOINT_SOLUTION_HISTORY_H
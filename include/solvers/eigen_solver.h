@@ -113,6 +113,25 @@ public:
     _close_matrix_before_solve = val;
   }
 
+  /**
+   * \returns \p true if solves reuse the solver's internal objects,
+   * and start from the eigenvectors of the previous solve.  \p false
+   * by default.
+   */
+  bool reusing_solver_context() const { return _reuse_solver_context; }
+
+  /**
+   * If \p reuse is true, each solve keeps the solver's internal
+   * objects (e.g. the SLEPc EPS, with its spectral transformation and
+   * linear solver) from the previous solve, and starts from the
+   * eigenvectors it converged, unless an initial space is set.  With
+   * shift-and-invert, operators which keep their nonzero pattern then
+   * only need a numeric refactorization.  This suits sequences of
+   * similar eigenproblems, e.g. in parameter continuation; \p clear()
+   * still starts over.
+   */
+  void reuse_solver_context(bool reuse) { _reuse_solver_context = reuse; }
+
   /**
    * Release all memory and clear data structures.
    */
@@ -359,6 +378,11 @@ protected:
   Real _target_val;
 
   bool _close_matrix_before_solve;
+
+  /**
+   * Whether solves reuse the solver context of the previous solve.
+   */
+  bool _reuse_solver_context;
 };
 
 } // namespace libMesh
@@ -24,6 +24,7 @@
 #include "libmesh/first_order_unsteady_solver.h"
 
 // C++ includes
+#include <memory>
 
 namespace libMesh
 {
@@ -60,6 +61,18 @@ public:
    */
   virtual ~EulerSolver ();
 
+  /**
+   * Discards any lumped mass, which will be reassembled on the next
+   * explicit solve.
+   */
+  virtual void reinit () override;
+
+  /**
+   * Takes an explicit step if \p lumped_mass_explicit is set, or
+   * solves the theta method system otherwise.
+   */
+  virtual void solve () override;
+
   /**
    * Error convergence order: 2 for Crank-Nicolson, 1 otherwise
    */
@@ -114,8 +127,38 @@ public:
    */
   Real theta;
 
+  /**
+   * If \p lumped_mass_explicit is true (it is false by default), then
+   * with \p theta = 0 each solve() takes a forward Euler step
+   * directly: the row-sum lumped mass is assembled on the first step,
+   * and each step then assembles only a residual and divides it
+   * pointwise by that mass.  No Jacobian is assembled and neither the
+   * DiffSolver nor any linear solver is used.
+   *
+   * This requires every variable to be first order time evolving,
+   * and a mass which doesn't depend on the solution.
+   */
+  bool lumped_mass_explicit;
+
 protected:
 
+  /**
+   * Assembles \p _inverse_lumped_mass.
+   */
+  void assemble_inverse_lumped_mass ();
+
+  /**
+   * The reciprocal of the row-sum lumped mass, with ones on
+   * constrained dofs.
+   */
+  std::unique_ptr<NumericVector<Number>> _inverse_lumped_mass;
+
+  /**
+   * True while the element residuals are to compute the mass matrix
+   * row sums, rather than the theta method residual.
+   */
+  bool _assembling_lumped_mass;
+
   /**
    * This method is the underlying implementation of the public
    * residual methods.
@@ -27,9 +27,11 @@
 #include "libmesh/equation_systems.h"
 #include "libmesh/libmesh.h"
 #include "libmesh/auto_ptr.h" // libmesh_make_unique
+#include "libmesh/threads.h"
 
 // C++ includes
 #include <list>
+#include <set>
 
 namespace libMesh
 {
@@ -83,11 +85,36 @@ public:
    */
   virtual std::unique_ptr<SolutionHistory > clone() const override
   {
-    return libmesh_make_unique<FileSolutionHistory>(_system);
+    auto history = libmesh_make_unique<FileSolutionHistory>(_system);
+    history->set_prefetch_depth(_prefetch_depth);
+    return std::unique_ptr<SolutionHistory>(history.release());
   }
 
+  /**
+   * Sets how many earlier timesteps an adjoint retrieve() reads ahead
+   * on a background thread, so that they are in the operating
+   * system's file cache by the time they are needed.  This defaults
+   * to 0, which turns prefetching off.
+   *
+   * Prefetching only overlaps with the adjoint solves if libMesh's
+   * Threads::Thread is concurrent.
+   */
+  void set_prefetch_depth (unsigned int depth)
+  { _prefetch_depth = depth; }
+
 private:
 
+  /**
+   * Starts reading the files of up to _prefetch_depth entries before
+   * stored_sols on a background thread.
+   */
+  void start_prefetch();
+
+  /**
+   * Waits for any background reads to finish.
+   */
+  void finish_prefetch();
+
   // This list of pairs will hold the timestamp and filename of each stored solution
   map_type stored_solutions;
 
@@ -120,6 +147,15 @@ private:
    * A vector of pointers to vectors holding the adjoint solution at the last time step
    */
   std::vector< std::unique_ptr<NumericVector<Number>> > dual_solution_copies;
+
+  // How many entries to read ahead during adjoint sweeps
+  unsigned int _prefetch_depth;
+
+  // The thread doing the reading ahead, if any
+  std::unique_ptr<Threads::Thread> _prefetch_thread;
+
+  // The files which have already been read ahead
+  std::set<std::string> _prefetched;
 };
 
 } // end namespace libMesh
@@ -214,6 +214,39 @@ public:
                                        const double,      // Stopping tolerance
                                        const unsigned int); // N. Iterations
 
+  /**
+   * Solves the system with \p matrix, preconditioned with
+   * \p precond_matrix if it is not null, for each vector in \p rhs,
+   * putting each solution in the corresponding vector of
+   * \p solutions.
+   *
+   * By default the systems are solved one after another, with the
+   * preconditioner built for the first one reused for the others.
+   * Solver packages which can solve several right hand sides at once
+   * override this.
+   *
+   * \returns The sums of the iteration counts and final residual
+   * norms of the individual solves.
+   */
+  virtual std::pair<unsigned int, Real>
+  solve_multiple (SparseMatrix<T> & matrix,
+                  SparseMatrix<T> * precond_matrix,
+                  const std::vector<NumericVector<T> *> & solutions,
+                  const std::vector<NumericVector<T> *> & rhs,
+                  const double tol,
+                  const unsigned int n_iter);
+
+  /**
+   * Solves the adjoint system with \p matrix for each vector in
+   * \p rhs, like \p solve_multiple().
+   */
+  virtual std::pair<unsigned int, Real>
+  adjoint_solve_multiple (SparseMatrix<T> & matrix,
+                          const std::vector<NumericVector<T> *> & solutions,
+                          const std::vector<NumericVector<T> *> & rhs,
+                          const double tol,
+                          const unsigned int n_iter);
+
 
 
   /**
@@ -0,0 +1,172 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_NATIVE_LINEAR_SOLVER_H
+#define LIBMESH_NATIVE_LINEAR_SOLVER_H
+
+// Local includes
+#include "libmesh/linear_solver.h"
+#include "libmesh/enum_convergence_flags.h"
+
+// C++ includes
+#include <functional>
+
+namespace libMesh
+{
+
+/**
+ * This class provides libMesh's own Krylov solvers, for use with
+ * \p CSRMatrix and \p DistributedVector when no external solver
+ * package is wanted.  Conjugate gradients is used for \p CG and
+ * restarted GMRES for \p GMRES; other solver types are not supported.
+ *
+ * Preconditioning is by an attached \p Preconditioner if there is
+ * one, none for \p IDENTITY_PRECOND, and Jacobi otherwise.  GMRES is
+ * right preconditioned, so both methods stop when the unpreconditioned
+ * residual norm falls below \p tol times the norm of the right hand
+ * side.
+ *
+ * Matrix-vector products, which dominate the cost, are threaded by
+ * \p CSRMatrix; the vector operations are not.
+ *
+ * \brief Native conjugate gradient and GMRES linear solvers.
+ */
+template <typename T>
+class NativeLinearSolver : public LinearSolver<T>
+{
+public:
+  /**
+   *  Constructor.
+   */
+  NativeLinearSolver (const libMesh::Parallel::Communicator & comm);
+
+  /**
+   * Release all memory and clear data structures.
+   */
+  virtual void clear () override;
+
+  /**
+   * Initialize data structures if not done so already.
+   */
+  virtual void init (const char * name = nullptr) override;
+
+  virtual std::pair<unsigned int, Real>
+  solve (SparseMatrix<T> & matrix,
+         NumericVector<T> & solution,
+         NumericVector<T> & rhs,
+         const double tol,
+         const unsigned int m_its) override;
+
+  /**
+   * Solves A^T x = b, with a transposed copy of \p matrix.
+   */
+  virtual std::pair<unsigned int, Real>
+  adjoint_solve (SparseMatrix<T> & matrix,
+                 NumericVector<T> & solution,
+                 NumericVector<T> & rhs,
+                 const double tol,
+                 const unsigned int m_its) override;
+
+  /**
+   * Solves with \p pc used in place of \p matrix to build the Jacobi
+   * preconditioner.
+   */
+  virtual std::pair<unsigned int, Real>
+  solve (SparseMatrix<T> & matrix,
+         SparseMatrix<T> & pc,
+         NumericVector<T> & solution,
+         NumericVector<T> & rhs,
+         const double tol,
+         const unsigned int m_its) override;
+
+  virtual std::pair<unsigned int, Real>
+  solve (const ShellMatrix<T> & shell_matrix,
+         NumericVector<T> & solution_in,
+         NumericVector<T> & rhs_in,
+         const double tol,
+         const unsigned int m_its) override;
+
+  virtual std::pair<unsigned int, Real>
+  solve (const ShellMatrix<T> & shell_matrix,
+         const SparseMatrix<T> & precond_matrix,
+         NumericVector<T> & solution_in,
+         NumericVector<T> & rhs_in,
+         const double tol,
+         const unsigned int m_its) override;
+
+  virtual LinearConvergenceReason get_converged_reason() const override
+  { return _reason; }
+
+  /**
+   * Sets the number of GMRES iterations between restarts.  The
+   * default is 30.
+   */
+  void set_gmres_restart (unsigned int restart)
+  { libmesh_assert_greater (restart, 0u); _restart = restart; }
+
+private:
+
+  /**
+   * Computes \p dest = A \p arg
+   */
+  typedef std::function<void (NumericVector<T> & dest,
+                              const NumericVector<T> & arg)> MatVec;
+
+  /**
+   * Solves with the selected method, applying the operator through
+   * \p apply and building any Jacobi preconditioner from \p diagonal.
+   */
+  std::pair<unsigned int, Real>
+  krylov_solve (const MatVec & apply,
+                const NumericVector<T> & diagonal,
+                NumericVector<T> & solution,
+                const NumericVector<T> & rhs,
+                const double tol,
+                const unsigned int m_its);
+
+  std::pair<unsigned int, Real>
+  cg (const MatVec & apply,
+      const MatVec & precondition,
+      NumericVector<T> & solution,
+      const NumericVector<T> & rhs,
+      const Real target,
+      const unsigned int m_its);
+
+  std::pair<unsigned int, Real>
+  gmres (const MatVec & apply,
+         const MatVec & precondition,
+         NumericVector<T> & solution,
+         const NumericVector<T> & rhs,
+         const Real target,
+         const unsigned int m_its);
+
+  /**
+   * The number of GMRES iterations between restarts
+   */
+  unsigned int _restart;
+
+  /**
+   * The reason the last solve stopped
+   */
+  LinearConvergenceReason _reason;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_NATIVE_LINEAR_SOLVER_H
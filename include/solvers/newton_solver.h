@@ -142,8 +142,51 @@ public:
    */
   double linear_tolerance_multiplier;
 
+  /**
+   * The number of Newton iterations for which each assembled
+   * jacobian, and the preconditioner built from it, is reused before
+   * the jacobian is assembled again, as with PETSc's
+   * -snes_lag_jacobian.  Iterations which reuse the jacobian only
+   * assemble the residual.
+   *
+   * Defaults to 1, assembling the jacobian on every iteration.
+   */
+  unsigned int jacobian_lag;
+
+  /**
+   * The number of later solve() calls (e.g. timesteps) which may
+   * begin with the last jacobian of a previous solve() rather than
+   * assembling a new one.  A jacobian carried over this way counts
+   * as newly assembled for the purposes of \p jacobian_lag.
+   *
+   * The system matrix must not be changed between solves when this
+   * is nonzero.  Defaults to 0.
+   */
+  unsigned int jacobian_lag_solves;
+
+  /**
+   * A reused jacobian is assembled again on the next iteration as
+   * soon as a Newton step taken with it needs a line search, or
+   * fails to reduce the residual norm by at least this factor.
+   *
+   * Defaults to 0.5.
+   */
+  Real jacobian_refresh_ratio;
+
 protected:
 
+  /**
+   * Whether the system matrix holds a jacobian we may reuse
+   */
+  bool _have_jacobian;
+
+  /**
+   * The number of Newton iterations, and of solve() calls, since
+   * the jacobian in the system matrix was assembled
+   */
+  unsigned int _jacobian_age;
+  unsigned int _jacobian_solve_age;
+
   /**
    * The \p LinearSolver defines the interface used to
    * solve the linear_implicit system.  This class handles all the
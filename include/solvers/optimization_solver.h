@@ -148,6 +148,14 @@ public:
    */
   OptimizationSystem::ComputeHessian * hessian_object;
 
+  /**
+   * Object that computes the product H_f(X) v of the Hessian of the
+   * objective function at the input iterate X with a vector v.  If
+   * this is set the solver uses a matrix-free Hessian, preconditioned
+   * by the one from \p hessian_object if that is also set.
+   */
+  OptimizationSystem::ComputeHessianVectorProduct * hessian_vector_product_object;
+
   /**
    * Object that computes the equality constraints vector C_eq(X).
    * This will lead to the constraints C_eq(X) = 0 being imposed.
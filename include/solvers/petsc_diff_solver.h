@@ -42,6 +42,9 @@
 namespace libMesh
 {
 
+// Forward declarations
+template <typename T> class ShellMatrix;
+
 /**
  * This class defines a solver which uses a PETSc SNES
  * context to handle a DifferentiableSystem
@@ -93,6 +96,32 @@ public:
    */
   virtual unsigned int solve () override;
 
+  /**
+   * Attaches a shell matrix, e.g. an \p FEMSystemShellMatrix, to use as
+   * the jacobian operator for matrix-free Newton-Krylov solves.  The
+   * system matrix is still assembled at each jacobian evaluation,
+   * but is then only used to build the preconditioner.  Supplying a
+   * \p nullptr restores the default behavior.
+   */
+  void attach_shell_matrix (ShellMatrix<Number> * shell_matrix)
+  { _shell_matrix = shell_matrix; }
+
+  /**
+   * Detaches a shell matrix.  Same as \p attach_shell_matrix(nullptr).
+   */
+  void detach_shell_matrix () { attach_shell_matrix(nullptr); }
+
+  /**
+   * If true, and a shell matrix is attached, the preconditioner
+   * applies the shell matrix rather than the assembled matrix where
+   * it needs the operator itself, e.g. in the finest level smoothers
+   * of geometric multigrid with \p --use_petsc_dm, while the coarser
+   * levels are still built from the assembled matrix.  This is the
+   * same as PETSc's \p -pc_use_amat option.  Defaults to false.
+   */
+  void use_shell_matrix_smoothing (bool use_shell)
+  { _shell_matrix_smoothing = use_shell; }
+
 protected:
 
   /**
@@ -109,6 +138,18 @@ protected:
 #endif
 #endif
 
+  /**
+   * User supplied jacobian shell matrix, or \p nullptr if the
+   * assembled system matrix is the jacobian.
+   */
+  ShellMatrix<Number> * _shell_matrix;
+
+  /**
+   * Whether the preconditioner should apply \p _shell_matrix where it
+   * needs the operator.
+   */
+  bool _shell_matrix_smoothing;
+
 private:
 
   /**
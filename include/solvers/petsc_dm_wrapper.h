@@ -105,6 +105,14 @@ namespace libMesh
     //! Destroys and clears all build DM-related data
     void clear();
 
+    /**
+     * Builds the DM hierarchy for \p system, including the
+     * interpolation matrices between its levels, and attaches the
+     * finest DM to \p snes.  If the hierarchy built by a previous call
+     * still matches the mesh and dofs of \p system, e.g. when a solver
+     * is reinitialized between timesteps without any mesh change, it
+     * is reattached as it is instead of being rebuilt.
+     */
     void init_and_attach_petscdm(System & system, SNES & snes);
 
   private:
@@ -169,6 +177,17 @@ namespace libMesh
     //! Stores n_local_dofs for each grid level, to be used for projection vector sizing
     std::vector<unsigned int> _mesh_dof_loc_sizes;
 
+    //! The hierarchy_signature() the current DMs were built for
+    std::vector<dof_id_type> _hierarchy_signature;
+
+    /**
+     * \returns Hashes of the active local elements and their levels,
+     * and the dof counts of \p system, which identify an \p n_levels
+     * hierarchy that can be reused.
+     */
+    std::vector<dof_id_type> hierarchy_signature(const System & system,
+                                                 unsigned int n_levels) const;
+
     //! Init all the n_mesh_level dependent data structures
     void init_dm_data(unsigned int n_levels, const Parallel::Communicator & comm);
 
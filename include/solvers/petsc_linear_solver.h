@@ -86,6 +86,7 @@ namespace libMesh
 
 // forward declarations
 template <typename T> class PetscMatrix;
+template <typename T> class PetscVector;
 
 /**
  * This class provides an interface to PETSc
@@ -143,6 +144,11 @@ public:
    * dofs on each processor only and not contain any duplicates.  This
    * mode can be disabled by calling this method with \p dofs being a
    * \p nullptr.
+   *
+   * The index sets, scatters and subvectors of the last subset are
+   * kept until the next clear(), and are reused if the same dofs are
+   * selected again, so that repeated solves on an unchanged subset
+   * only move the subset values.
    */
   virtual void restrict_solve_to (const std::vector<unsigned int> * const dofs,
                                   const SubsetSolveMode subset_solve_mode=SUBSET_ZERO) override;
@@ -220,6 +226,24 @@ public:
          const double tol,
          const unsigned int m_its) override;
 
+#if !PETSC_VERSION_LESS_THAN(3,14,0)
+  /**
+   * Solves for all the right hand sides at once with KSPMatSolve(),
+   * which applies the matrix and preconditioner to blocks of vectors,
+   * and with \p -ksp_type \p hpddm solves with block Krylov methods.
+   * Falls back on solving one right hand side at a time when the
+   * solve is restricted to a subset of dofs, or a \p Preconditioner
+   * is attached.
+   */
+  virtual std::pair<unsigned int, Real>
+  solve_multiple (SparseMatrix<T> & matrix,
+                  SparseMatrix<T> * precond_matrix,
+                  const std::vector<NumericVector<T> *> & solutions,
+                  const std::vector<NumericVector<T> *> & rhs,
+                  const double tol,
+                  const unsigned int m_its) override;
+#endif
+
   /**
    * \returns The raw PETSc preconditioner context pointer.
    *
@@ -291,29 +315,79 @@ private:
   WrappedPetsc<KSP> _ksp;
 
   /**
-   * PETSc index set containing the dofs on which to solve (\p nullptr
-   * means solve on all dofs).
+   * The PETSc objects used to restrict solves to a subset of the
+   * dofs.  They only depend on the subset and the parallel layout of
+   * the system vectors, so they are built on demand and kept while
+   * the same subset is selected.
    */
-  WrappedPetsc<IS> _restrict_solve_to_is;
+  struct SubsetData
+  {
+    /**
+     * The dofs in the subset, to recognize a repeated selection.
+     */
+    std::vector<unsigned int> dofs;
+
+    /**
+     * Index sets of the subset dofs and of the local dofs not in the
+     * subset.
+     */
+    WrappedPetsc<IS> is;
+    WrappedPetsc<IS> complement_is;
+
+    /**
+     * Scatters from full vectors to \p rhs (or \p solution) and to
+     * \p complement.
+     */
+    WrappedPetsc<VecScatter> scatter;
+    WrappedPetsc<VecScatter> complement_scatter;
+
+    /**
+     * The subset right hand side and solution, the values outside the
+     * subset, and a subset sized work vector.
+     */
+    WrappedPetsc<Vec> rhs;
+    WrappedPetsc<Vec> solution;
+    WrappedPetsc<Vec> complement;
+    WrappedPetsc<Vec> work;
+  };
+
+  SubsetData _subset;
 
   /**
-   * PETSc index set, complement to \p _restrict_solve_to_is.  This
-   * will be created on demand by the method \p
-   * _create_complement_is().
+   * Whether solves are currently restricted to \p _subset.
    */
-  WrappedPetsc<IS> _restrict_solve_to_is_complement;
+  bool _restrict_solve;
 
   /**
-   * \returns The local size of \p _restrict_solve_to_is.
+   * \returns The local size of \p _subset.is.
    */
   PetscInt restrict_solve_to_is_local_size() const;
 
   /**
-   * Creates \p _restrict_solve_to_is_complement to contain all
-   * indices that are local in \p vec_in, except those that are
-   * contained in \p _restrict_solve_to_is.
+   * Creates \p _subset.complement_is to contain all indices that are
+   * local in \p vec_in, except those that are contained in
+   * \p _subset.is, along with the vector and scatter for the values
+   * at those indices.
+   */
+  void create_complement_is (const PetscVector<T> & vec_in);
+
+  /**
+   * Scatters the subset values of \p rhs and \p solution into
+   * \p _subset.rhs and \p _subset.solution.  Unless
+   * \p _subset_solve_mode is \p SUBSET_ZERO, the coupling through
+   * \p mat to the fixed values outside the subset is moved to the
+   * subset right hand side.
+   */
+  void restrict_vectors_to_subset (Mat mat,
+                                   PetscVector<T> & rhs,
+                                   PetscVector<T> & solution);
+
+  /**
+   * Scatters the subset solution back into \p solution, and sets the
+   * values outside the subset as \p _subset_solve_mode requires.
    */
-  void create_complement_is (const NumericVector<T> & vec_in);
+  void extend_solution_from_subset (PetscVector<T> & rhs,
+                                    PetscVector<T> & solution);
 
   /**
    * If restrict-solve-to-subset mode is active, this member decides
@@ -108,6 +108,12 @@ public:
 
 protected:
 
+  /**
+   * Updates the ghosted old solution, rate and acceleration vectors
+   * together, so that their ghost values are communicated at once.
+   */
+  virtual void localize_old_solutions () override;
+
   /**
    * Serial vector of previous time step velocity \f$ \dot{u}_n \f$
    */
@@ -27,6 +27,7 @@
 // Local includes
 #include "libmesh/eigen_solver.h"
 #include "libmesh/slepc_macro.h"
+#include "libmesh/wrapped_petsc.h"
 
 // SLEPc include files.
 EXTERN_C_FOR_SLEPC_BEGIN
@@ -35,6 +36,9 @@ EXTERN_C_FOR_SLEPC_BEGIN
 # include "libmesh/restore_warnings.h"
 EXTERN_C_FOR_SLEPC_END
 
+// C++ includes
+#include <vector>
+
 namespace libMesh
 {
  template <typename T> class PetscVector;
@@ -278,6 +282,19 @@ private:
                                                                    const double tol,
                                                                    const unsigned int m_its);
 
+  /**
+   * Sets the initial space of the eigensolve for operator \p mat,
+   * either to \p _initial_space or to the vectors saved by
+   * _save_converged_space().
+   */
+  void _set_initial_space (Mat mat);
+
+  /**
+   * Saves up to \p nev converged eigenvectors for the next solve, if
+   * the solver context is being reused.
+   */
+  void _save_converged_space (Mat mat, PetscInt nconv, int nev);
+
   /**
    * Tells Slepc to use the user-specified solver stored in
    * \p _eigen_solver_type
@@ -319,6 +336,12 @@ private:
    * A vector used for initial space. The vector will be used as the basis for EPS.
    */
   PetscVector<T>* _initial_space;
+
+  /**
+   * The eigenvectors converged by the previous solve, if the solver
+   * context is being reused.
+   */
+  std::vector<WrappedPetsc<Vec>> _converged_space;
 };
 
 } // namespace libMesh
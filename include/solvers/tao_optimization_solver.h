@@ -28,6 +28,8 @@
 // Local includes
 #include "libmesh/petsc_macro.h"
 #include "libmesh/optimization_solver.h"
+#include "libmesh/petsc_macro.h"
+#include "libmesh/wrapped_petsc.h"
 
 // Include header for the Tao optimization library
 #ifdef I
@@ -48,6 +50,7 @@ extern "C"
   PetscErrorCode __libmesh_tao_objective (Tao tao, Vec x, PetscReal * objective, void * ctx);
   PetscErrorCode __libmesh_tao_gradient(Tao tao, Vec x, Vec g, void * ctx);
   PetscErrorCode __libmesh_tao_hessian(Tao tao, Vec x, Mat h, Mat pc, void * ctx);
+  PetscErrorCode __libmesh_tao_hessian_vector_product(Mat h, Vec v, Vec hv);
   PetscErrorCode __libmesh_tao_equality_constraints(Tao tao, Vec x, Vec ce, void * ctx);
   PetscErrorCode __libmesh_tao_equality_constraints_jacobian(Tao tao, Vec x, Mat J, Mat Jpre, void * ctx);
   PetscErrorCode __libmesh_tao_inequality_constraints(Tao tao, Vec x, Vec cineq, void * ctx);
@@ -141,11 +144,35 @@ protected:
    */
   TaoConvergedReason _reason;
 
+  /**
+   * The matrix-free Hessian, if a \p hessian_vector_product_object is
+   * given.
+   */
+  WrappedPetsc<Mat> _hessian_shell;
+
 private:
 
+  /**
+   * Updates the system's current_local_solution from the iterate
+   * \p x and enforces constraints on it, unless it was last updated
+   * from the same, unchanged, vector.
+   */
+  void update_current_local_solution (Vec x);
+
+  /**
+   * The PETSc id and state of the iterate current_local_solution was
+   * last updated from, if \p _have_current_x.
+   */
+  bool _have_current_x;
+#if !PETSC_RELEASE_LESS_THAN(3,10,0)
+  PetscObjectId _current_x_id;
+  PetscObjectState _current_x_state;
+#endif
+
   friend PetscErrorCode __libmesh_tao_objective (Tao tao, Vec x, PetscReal * objective, void * ctx);
   friend PetscErrorCode __libmesh_tao_gradient(Tao tao, Vec x, Vec g, void * ctx);
   friend PetscErrorCode __libmesh_tao_hessian(Tao tao, Vec x, Mat h, Mat pc, void * ctx);
+  friend PetscErrorCode __libmesh_tao_hessian_vector_product(Mat h, Vec v, Vec hv);
   friend PetscErrorCode __libmesh_tao_equality_constraints(Tao tao, Vec x, Vec ce, void * ctx);
   friend PetscErrorCode __libmesh_tao_equality_constraints_jacobian(Tao tao, Vec x, Mat J, Mat Jpre, void * ctx);
   friend PetscErrorCode __libmesh_tao_inequality_constraints(Tao tao, Vec x, Vec cineq, void * ctx);
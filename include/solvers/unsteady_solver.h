@@ -169,6 +169,20 @@ public:
    */
   std::shared_ptr<NumericVector<Number>> old_local_nonlinear_solution;
 
+  /**
+   * If reuse_current_local_solution is true (it is false by
+   * default), advance_timestep() fills old_local_nonlinear_solution
+   * by copying the system's current_local_solution, rather than by
+   * localizing the new old solution with another round of
+   * communication.
+   *
+   * This requires current_local_solution to be up to date with the
+   * system solution whenever advance_timestep() is called, as it is
+   * after a solve() or a System::update(), but not after the solution
+   * is modified by hand.
+   */
+  bool reuse_current_local_solution;
+
   /**
    * Computes the size of ||u^{n+1} - u^{n}|| in some norm.
    *
@@ -195,6 +209,14 @@ public:
 
 protected:
 
+  /**
+   * Brings the ghosted copies of the old solution vectors up to date
+   * with the old solutions stored in the system, at the end of
+   * advance_timestep().  Subclasses with more history vectors should
+   * override this to update them all together.
+   */
+  virtual void localize_old_solutions ();
+
   /**
    * A bool that will be true the first time solve() is called,
    * and false thereafter
@@ -0,0 +1,165 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_AD_FEM_CONTEXT_H
+#define LIBMESH_AD_FEM_CONTEXT_H
+
+#include "libmesh/libmesh_config.h"
+
+#ifdef LIBMESH_HAVE_METAPHYSICL
+
+// With quad precision we need the shim function declarations to
+// precede the MetaPhysicL use of them
+#include "libmesh/libmesh_common.h"
+
+#include "libmesh/ignore_warnings.h"
+#include "metaphysicl/dualdynamicsparsenumberarray.h"
+#include "libmesh/restore_warnings.h"
+
+// Local Includes
+#include "libmesh/compare_types.h"
+#include "libmesh/fem_context.h"
+#include "libmesh/vector_value.h"
+
+// C++ includes
+#include <vector>
+
+namespace libMesh
+{
+
+/**
+ * A dual number whose derivatives are taken with respect to the
+ * local degrees of freedom of the current element, indexed as in
+ * DiffContext::get_elem_solution().
+ */
+typedef MetaPhysicL::DualNumber
+  <Number, MetaPhysicL::DynamicSparseNumberArray<Number, unsigned int>>
+  ADNumber;
+
+typedef VectorValue<ADNumber> ADGradient;
+
+// From the perspective of libMesh gradient vectors, an ADNumber is a
+// scalar component, which can be combined with our own scalars.
+template <>
+struct ScalarTraits<ADNumber>
+{
+  static const bool value = true;
+};
+
+template <>
+struct CompareTypes<ADNumber, Real>
+{
+  typedef ADNumber supertype;
+};
+
+template <>
+struct CompareTypes<Real, ADNumber>
+{
+  typedef ADNumber supertype;
+};
+
+/**
+ * An FEMContext which can evaluate the solution as dual numbers
+ * seeded with derivatives with respect to the element degrees of
+ * freedom, and accumulate a dual number element residual.  Physics
+ * code which computes its residual from ad_interior_value() and
+ * ad_interior_gradient() into ad_elem_residual() then gets the exact
+ * element jacobian from add_ad_residual(), in the same pass that
+ * computes the residual, without hand-coding it and at a fraction of
+ * the cost of FEMSystem::numerical_elem_jacobian().
+ *
+ * FEMSystem builds contexts of this type when FEMSystem::ad_contexts
+ * is set.
+ *
+ * \brief An FEMContext with automatic differentiation of residuals.
+ */
+class ADFEMContext : public FEMContext
+{
+public:
+
+  /**
+   * Constructor.  Allocates some but fills no data structures.
+   */
+  explicit
+  ADFEMContext (const System & sys);
+
+  /**
+   * Constructor.  Specify the extra quadrature order instead
+   * of getting it from \p sys.
+   */
+  explicit
+  ADFEMContext (const System & sys, int extra_quadrature_order);
+
+  /**
+   * Also resizes and zeroes the dual number element residual.
+   */
+  virtual void pre_fe_reinit(const System &,
+                             const Elem * e) override;
+
+  /**
+   * \returns The value of the scalar-valued solution variable \p var
+   * at the quadrature point \p qp on the current element interior,
+   * with its derivatives with respect to the element degrees of
+   * freedom.
+   */
+  ADNumber ad_interior_value(unsigned int var, unsigned int qp) const;
+
+  /**
+   * \returns The gradient of the scalar-valued solution variable
+   * \p var at the quadrature point \p qp on the current element
+   * interior, with its derivatives with respect to the element
+   * degrees of freedom.
+   */
+  ADGradient ad_interior_gradient(unsigned int var, unsigned int qp) const;
+
+  /**
+   * \returns The dual number element residual entry for the \p i
+   * th degree of freedom of variable \p var.
+   */
+  ADNumber & ad_elem_residual(unsigned int var, unsigned int i)
+  {
+    libmesh_assert_less (i, this->get_elem_residual(var).size());
+    return _ad_elem_residual[this->get_elem_residual(var).i_off() + i];
+  }
+
+  /**
+   * Adds the values of the dual number element residual to the
+   * element residual and, if \p request_jacobian is true, their
+   * derivatives, scaled by get_elem_solution_derivative(), to the
+   * element jacobian, and then zeroes the dual number residual.
+   *
+   * Physics code should call this at the end of each residual
+   * function which uses ad_elem_residual(), so that time solvers
+   * see the result of each function separately.
+   */
+  void add_ad_residual(bool request_jacobian);
+
+protected:
+
+  /**
+   * The dual number element residual
+   */
+  std::vector<ADNumber> _ad_elem_residual;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_HAVE_METAPHYSICL
+
+#endif // LIBMESH_AD_FEM_CONTEXT_H
@@ -28,6 +28,10 @@
 // Local Includes
 #include "libmesh/eigen_system.h"
 #include "libmesh/sparse_matrix.h"
+#include "libmesh/shell_matrix.h"
+
+// C++ includes
+#include <memory>
 
 namespace libMesh
 {
@@ -149,8 +153,33 @@ public:
    */
   std::vector<dof_id_type> local_non_condensed_dofs_vector;
 
+  /**
+   * If true, solve() applies the condensed operators matrix-free,
+   * restricting each product with the full matrices on the fly,
+   * rather than extracting condensed copies of them on every solve.
+   *
+   * Only the condensed matrix which preconditions the spectral
+   * transformation's linear solves is built, in condensed_matrix_A,
+   * and condensed_matrix_B is freed.  That matrix is the restriction
+   * of the system matrix named "Eigen Preconditioner", if the user has
+   * added one (e.g. holding A - sigma B for shift-and-invert), and
+   * otherwise of matrix_B for generalized problems or of matrix_A for
+   * standard ones.
+   *
+   * By default, this flag is false.
+   */
+  bool matrix_free_condensation;
+
 private:
 
+  /**
+   * The matrix-free condensed operators, if matrix_free_condensation
+   * is in use.  These outlive each solve, since the eigensolver may
+   * keep references to them.
+   */
+  std::unique_ptr<ShellMatrix<Number>> _condensed_shell_A;
+  std::unique_ptr<ShellMatrix<Number>> _condensed_shell_B;
+
   /**
    * A private flag to indicate whether the condensed dofs
    * have been initialized.
@@ -259,6 +259,17 @@ public:
    */
   bool newton_progress_check;
 
+  /**
+   * If a Newton step (or a whole arcstep) reduces the nonlinear
+   * residual by at least this factor, the next Newton step reuses the
+   * current Jacobian and preconditioner instead of reassembling them,
+   * and so does the first Newton step of the next arcstep, with the
+   * Jacobian from the tangent solve.  A lagged step which converges
+   * less well is followed by a fresh Jacobian.  The default, 0, never
+   * lags the Jacobian.
+   */
+  Real jacobian_lag_ratio;
+
 protected:
   /**
    * Initializes the member data fields associated with
@@ -419,6 +430,12 @@ private:
    * Loop counter for nonlinear (Newton) iteration loop.
    */
   unsigned int newton_step;
+
+  /**
+   * True if the next Newton step should reuse the Jacobian currently
+   * stored in the system matrix.  See \p jacobian_lag_ratio.
+   */
+  bool lag_jacobian;
 };
 
 } // namespace libMesh
@@ -23,6 +23,9 @@
 // Local Includes
 #include "libmesh/fem_context.h"
 
+// C++ includes
+#include <unordered_map>
+
 
 namespace libMesh
 {
@@ -238,8 +241,72 @@ public:
   template<typename OutputShape>
   void get_neighbor_side_fe( unsigned int var, FEGenericBase<OutputShape> *& fe ) const;
 
+  /**
+   * \returns \p true if the DG terms on the face between get_elem()
+   * and \p neighbor should be assembled while visiting get_elem().
+   *
+   * A loop over active elements sees each interior face twice, once
+   * from each side.  Since the elem-elem, elem-neighbor,
+   * neighbor-elem and neighbor-neighbor Jacobians and the neighbor
+   * residual already hold the whole face contribution, assembly code
+   * can skip the faces for which this returns \p false and so
+   * integrate every face only once.  The face is owned by the finer
+   * element on a nonconforming face, and by the element with the
+   * lower id otherwise, so exactly one of the two elements, which is
+   * local on exactly one processor, owns it.
+   */
+  bool owns_dg_face (const Elem & neighbor) const;
+
+  /**
+   * Overwrites \p residual, which holds the current element's dofs
+   * for all variables, with \f$ M_e^{-1} \f$ times itself, where
+   * \f$ M_e \f$ is the element's block diagonal mass matrix.
+   *
+   * For discontinuous variables the global mass matrix is block
+   * diagonal, so this applies its inverse element by element, e.g. to
+   * take an explicit step or to precondition an implicit one, without
+   * assembling or solving a global mass matrix.
+   *
+   * The Cholesky factors of each element's mass matrix blocks are
+   * computed on first use and cached by element id and p level, so
+   * clear_inverse_mass_cache() must be called if the mesh is moved
+   * or renumbered while this context is in use.  Only scalar
+   * discontinuous variables are supported.
+   */
+  void elem_inverse_mass_apply (DenseVector<Number> & residual);
+
+  /**
+   * Overwrites \p residual, which holds the current element's dofs for
+   * variable \p var, with the inverse mass matrix block of \p var
+   * times itself.
+   */
+  void elem_inverse_mass_apply (unsigned int var,
+                                DenseVector<Number> & residual);
+
+  /**
+   * Discards the cached element mass matrix factors.
+   */
+  void clear_inverse_mass_cache ()
+  { _inverse_mass_cache.clear(); }
+
 private:
 
+  /**
+   * \returns The Cholesky factored mass matrix blocks, one per
+   * variable, of the current element, computing them if they are not
+   * already cached.
+   */
+  std::vector<DenseMatrix<Real>> & elem_mass_factors ();
+
+  /**
+   * Cached Cholesky factors of one element's mass matrix blocks
+   */
+  struct ElemMassFactors
+  {
+    unsigned int p_level;
+    std::vector<DenseMatrix<Real>> factors;
+  };
+
   /**
    * Current neighbor element for assembling DG terms.
    */
@@ -289,6 +356,19 @@ private:
    */
   std::vector<FEAbstract *> _neighbor_side_fe_var;
 
+  /**
+   * Finite element objects and quadrature rules used to build
+   * element mass matrices, independently of the assembly FE objects
+   * and whichever data they have been asked to compute.
+   */
+  std::map<FEType, std::unique_ptr<FEBase>> _mass_fe;
+  std::map<FEType, std::unique_ptr<QBase>> _mass_qrule;
+
+  /**
+   * Element mass matrix factors, by element id.
+   */
+  std::unordered_map<dof_id_type, ElemMassFactors> _inverse_mass_cache;
+
   /**
    * Boolean flag to indicate whether or not the DG terms have been
    * assembled and should be used in the global matrix assembly.
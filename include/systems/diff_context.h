@@ -113,9 +113,12 @@ public:
 
   /**
    * Non-const accessor for element solution.
+   *
+   * \note Since the element solution may be modified through the
+   * returned reference, this also changes elem_solution_version().
    */
   DenseVector<Number> & get_elem_solution()
-  { return _elem_solution; }
+  { ++_elem_solution_version; return _elem_solution; }
 
   /**
    * Accessor for element solution of a particular variable corresponding
@@ -136,9 +139,18 @@ public:
   {
     libmesh_assert_greater(_elem_subsolutions.size(), var);
     libmesh_assert(_elem_subsolutions[var]);
+    ++_elem_solution_version;
     return *(_elem_subsolutions[var]);
   }
 
+  /**
+   * \returns A counter which changes every time the non-const element
+   * solution accessors are used, so that data computed from the
+   * element solution can tell when it may be out of date.
+   */
+  unsigned int elem_solution_version() const
+  { return _elem_solution_version; }
+
   /**
    * Accessor for element solution rate of change w.r.t. time.
    */
@@ -581,6 +593,11 @@ protected:
   DenseVector<Number> _elem_solution;
   std::vector<std::unique_ptr<DenseSubVector<Number>>> _elem_subsolutions;
 
+  /**
+   * Incremented by the non-const element solution accessors
+   */
+  unsigned int _elem_solution_version;
+
   /**
    * Element by element components of du/dt
    * as adjusted by a time_solver
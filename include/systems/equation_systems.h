@@ -298,6 +298,10 @@ public:
    * the names from \p build_variable_names()).
    * If systems_names!=nullptr, only include data from the
    * specified systems.
+   *
+   * \note The input vector \p soln will only be filled on processor
+   * 0, which gathers it from the parallel solution vector in bounded
+   * chunks, and will be empty on other processors.
    */
   void build_solution_vector (std::vector<Number> & soln,
                               const std::set<std::string> * system_names=nullptr) const;
@@ -489,6 +493,14 @@ public:
    */
   void print_info (std::ostream & os=libMesh::out) const;
 
+  /**
+   * Prints a table of the memory used by the mesh and by each
+   * system, by component, with its minimum, maximum and total over
+   * all processors.  Must be called on every processor; only
+   * processor 0 prints.
+   */
+  void print_memory_report (std::ostream & os=libMesh::out) const;
+
   /**
    * Same as above, but allows you to also use stream syntax.
    */
@@ -526,6 +538,29 @@ public:
    **/
   bool refine_in_reinit_flag() { return this->_refine_in_reinit; }
 
+  /**
+   * Calls to reinit() will check each system, after renumbering its
+   * dofs, for a numbering, send list and constraints identical to
+   * those before the mesh change, e.g. when its variables live only
+   * on subdomains which were not refined, coarsened or
+   * repartitioned.  Such systems skip the projection of their
+   * vectors and the recomputation of their sparsity pattern and
+   * matrices.  The check itself is linear in the number of local
+   * dofs.
+   **/
+  void enable_incremental_reinit() { this->_incremental_reinit = true; }
+
+  /**
+   * Calls to reinit() will project and reinitialize every system
+   **/
+  void disable_incremental_reinit() { this->_incremental_reinit = false; }
+
+  /**
+   * \returns Whether or not calls to reinit() will skip systems which
+   * the mesh change left untouched
+   **/
+  bool incremental_reinit_flag() const { return this->_incremental_reinit; }
+
   /**
    * Handle any mesh changes and project any solutions onto the
    * updated mesh.
@@ -574,6 +609,13 @@ protected:
    */
   bool _refine_in_reinit;
 
+  /**
+   * Flag for whether reinit() skips the projection and matrix
+   * reinitialization of systems with unchanged dofs.
+   * Default value: false
+   */
+  bool _incremental_reinit;
+
   /**
    * Flag for whether to enable default ghosting on newly added Systems.
    * Default value: true
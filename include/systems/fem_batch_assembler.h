@@ -0,0 +1,155 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_FEM_BATCH_ASSEMBLER_H
+#define LIBMESH_FEM_BATCH_ASSEMBLER_H
+
+// Local Includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/id_types.h"
+
+// C++ includes
+#include <cstddef>
+#include <vector>
+
+namespace libMesh
+{
+
+// Forward Declarations
+class Elem;
+class FEMSystem;
+
+/**
+ * The data for one batch of elements in a batched FEMSystem
+ * assembly.  Every element of a batch has the same subdomain, element
+ * type and p level, and so the same quadrature rule.  Per-element data
+ * is stored contiguously, element after element, so that a batch can
+ * be copied to an accelerator in a handful of transfers.
+ */
+struct FEMElementBatch
+{
+  /**
+   * Clears the batch, keeping its allocations.
+   */
+  void clear()
+  {
+    elems.clear();
+    dof_offsets.assign(1, 0);
+    dof_indices.clear();
+    solution.clear();
+    JxW.clear();
+    xyz.clear();
+    residuals.clear();
+    jacobian_offsets.clear();
+    jacobians.clear();
+  }
+
+  /**
+   * \returns The number of elements in the batch.
+   */
+  std::size_t size() const { return elems.size(); }
+
+  /**
+   * \returns The number of degrees of freedom on element \p e.
+   */
+  std::size_t n_dofs(std::size_t e) const
+  { return dof_offsets[e+1] - dof_offsets[e]; }
+
+  /**
+   * \returns The offset of the dense, row-major jacobian of element
+   * \p e in \p jacobians.
+   */
+  std::size_t jacobian_offset(std::size_t e) const
+  { return jacobian_offsets[e]; }
+
+  /**
+   * The elements in the batch.
+   */
+  std::vector<const Elem *> elems;
+
+  /**
+   * The number of quadrature points on each element.
+   */
+  unsigned int n_qp = 0;
+
+  /**
+   * The dofs of element \p e are \p dof_indices[dof_offsets[e]] to
+   * \p dof_indices[dof_offsets[e+1]-1], in FEMContext order.
+   */
+  std::vector<std::size_t> dof_offsets = std::vector<std::size_t>(1, 0);
+  std::vector<dof_id_type> dof_indices;
+
+  /**
+   * The current solution at each of those dofs.
+   */
+  std::vector<Number> solution;
+
+  /**
+   * The quadrature weights times the map Jacobian, at \p e*n_qp+qp,
+   * and the physical quadrature point coordinates, at
+   * \p (e*n_qp+qp)*LIBMESH_DIM+d.
+   */
+  std::vector<Real> JxW;
+  std::vector<Real> xyz;
+
+  /**
+   * The element residuals, laid out like \p solution, and the dense,
+   * row-major element jacobians, starting at \p jacobian_offsets[e].
+   * These are sized and zeroed before the batch is handed to the
+   * assembler, which fills in whichever were requested.
+   */
+  std::vector<Number> residuals;
+  std::vector<std::size_t> jacobian_offsets;
+  std::vector<Number> jacobians;
+};
+
+
+
+/**
+ * An interface for computing the element residuals and jacobians of
+ * a FEMSystem a batch of elements at a time, e.g. on an accelerator,
+ * in place of the element-by-element time solver and physics calls.
+ *
+ * FEMSystem gathers each batch on the host, hands it to
+ * assemble_batch(), and then applies constraints and inserts the
+ * results into the global system as in ordinary assembly.
+ */
+class FEMBatchAssembler
+{
+public:
+
+  virtual ~FEMBatchAssembler () {}
+
+  /**
+   * Fills \p batch.residuals if \p get_residual is true and
+   * \p batch.jacobians if \p get_jacobian is true, with the full
+   * unconstrained element contributions, including any time
+   * discretization terms, that the time solver would otherwise
+   * compute for each element of the batch.
+   */
+  virtual void assemble_batch (const FEMSystem & sys,
+                               FEMElementBatch & batch,
+                               bool get_residual,
+                               bool get_jacobian) = 0;
+};
+
+} // namespace libMesh
+
+
+#endif // LIBMESH_FEM_BATCH_ASSEMBLER_H
@@ -47,6 +47,49 @@ class QBase;
 class Point;
 template <typename T> class NumericVector;
 
+/**
+ * Storage for the FE data computed by FEMContext::elem_fe_reinit()
+ * and FEMContext::side_fe_reinit() on each element, which contexts
+ * given the cache with FEMContext::set_fe_reinit_cache() restore
+ * instead of recomputing the mapping and shape functions.
+ *
+ * The data is only valid while the mesh does not move, and contexts
+ * sharing a cache must request the same FE quantities.  Entries are
+ * indexed by element id, so several threads may share a cache as
+ * long as each element is only worked on by one of them and resize()
+ * has been called beforehand.
+ */
+class FEReinitCache
+{
+public:
+  /**
+   * Discards all saved data.
+   */
+  void clear () { _entries.clear(); }
+
+  /**
+   * Makes room for elements with ids less than \p max_elem_id,
+   * keeping any saved data.
+   */
+  void resize (dof_id_type max_elem_id) { _entries.resize(max_elem_id); }
+
+private:
+  friend class FEMContext;
+
+  struct Entry
+  {
+    const Elem * elem = nullptr;
+    unsigned int p_level = 0;
+    std::vector<std::unique_ptr<FEAbstract::ReinitData>> fe_data;
+  };
+
+  /**
+   * The interior entry followed by one entry per side, for each
+   * element id
+   */
+  std::vector<std::vector<Entry>> _entries;
+};
+
 /**
  * This class provides all data required for a physics package
  * (e.g. an FEMSystem subclass) to perform local element residual
@@ -366,6 +409,19 @@ public:
                        const NumericVector<Number> & _system_vector,
                        std::vector<OutputType> & interior_values_vector) const;
 
+  /**
+   * \returns The values of the scalar-valued solution variable \p var
+   * at all the quadrature points in the current element interior.
+   *
+   * The values at every quadrature point are computed together the
+   * first time they are requested after an elem_fe_reinit(), and are
+   * reused until the next elem_fe_reinit() or until the element
+   * solution is obtained through a non-const accessor.  FE objects
+   * reinitialized directly, rather than via elem_fe_reinit(), are not
+   * detected; use interior_value() in that case.
+   */
+  const std::vector<Number> & interior_values(unsigned int var) const;
+
   /**
    * \returns The value of the solution variable \p var at the quadrature
    * point \p qp on the current element side.
@@ -422,6 +478,15 @@ public:
                           const NumericVector<Number> & _system_vector,
                           std::vector<OutputType> & interior_gradients_vector) const;
 
+  /**
+   * \returns The gradients of the scalar-valued solution variable
+   * \p var at all the quadrature points in the current element
+   * interior.
+   *
+   * These are cached in the same way as by interior_values(unsigned int).
+   */
+  const std::vector<Gradient> & interior_gradients(unsigned int var) const;
+
   /**
    * \returns The gradient of the solution variable \p var at the quadrature
    * point \p qp on the current element side.
@@ -768,11 +833,19 @@ public:
 
   /**
    * Reinitializes interior FE objects on the current geometric element
+   *
+   * If an FEReinitCache has been set, data saved on the current
+   * element is restored instead, unless \p pts is given or the mesh
+   * is being moved by a mesh system.  Otherwise, FE objects matching
+   * one in an FE data source which is already reinitialized on the
+   * current element copy its data rather than recomputing it.
    */
   virtual void elem_fe_reinit(const std::vector<Point> * const pts = nullptr);
 
   /**
    * Reinitializes side FE objects on the current geometric element
+   *
+   * This uses any FEReinitCache in the same way as elem_fe_reinit().
    */
   virtual void side_fe_reinit();
 
@@ -781,6 +854,46 @@ public:
    */
   virtual void edge_fe_reinit();
 
+  /**
+   * Sets the cache used to save and restore FE data on each element,
+   * or stops using one if \p cache is null.
+   */
+  void set_fe_reinit_cache(FEReinitCache * cache)
+  { _fe_reinit_cache = cache; }
+
+  /**
+   * Sets the contexts, e.g. of other systems on the same mesh, whose
+   * interior FE data elem_fe_reinit() may copy.  An interior FE
+   * object is copied from the first source with an FE object of the
+   * same type and quadrature rule which was last reinitialized at the
+   * quadrature points of the same element.
+   *
+   * As with an FEReinitCache, matching FE objects must request the
+   * same FE quantities.
+   */
+  void set_fe_data_sources(std::vector<const FEMContext *> sources)
+  { _fe_data_sources = std::move(sources); }
+
+  /**
+   * Tells pre_fe_reinit() whether to leave the element jacobian and
+   * its per-variable blocks empty, for a context which will only be
+   * used to compute residuals.  This saves allocating and zeroing
+   * them on every element.
+   *
+   * Physics code given such a context must not touch the element
+   * jacobian unless \p request_jacobian is true, which it never will
+   * be.
+   */
+  void set_residual_only(bool residual_only)
+  { _residual_only = residual_only; }
+
+  /**
+   * \returns \p true if pre_fe_reinit() leaves the element jacobian
+   * empty.
+   */
+  bool residual_only() const
+  { return _residual_only; }
+
   /**
    * Accessor for element interior quadrature rule for the dimension of the
    * current _elem.
@@ -1057,6 +1170,93 @@ protected:
   mutable bool _real_grad_fe_is_inf;
 #endif
 
+  /**
+   * Solution values and gradients of one variable at the element
+   * interior quadrature points, stamped with the element solution
+   * version and elem_fe_reinit() count they were computed for.
+   */
+  struct InteriorQpData
+  {
+    unsigned int solution_version = 0;
+    unsigned int fe_reinit_count = 0;
+    bool have_values = false;
+    bool have_gradients = false;
+    std::vector<Number> values;
+    std::vector<Gradient> gradients;
+  };
+
+  /**
+   * \returns The cached quadrature point data for \p var, emptied
+   * first if it is out of date.
+   */
+  InteriorQpData & interior_qp_data(unsigned int var) const;
+
+  /**
+   * Incremented by every elem_fe_reinit()
+   */
+  unsigned int _elem_fe_reinit_count;
+
+  /**
+   * Saved FE data to restore on each element, if any
+   */
+  FEReinitCache * _fe_reinit_cache;
+
+  /**
+   * Whether the element jacobian is left empty
+   */
+  bool _residual_only;
+
+  /**
+   * Contexts whose interior FE data we may copy
+   */
+  std::vector<const FEMContext *> _fe_data_sources;
+
+  /**
+   * The element at whose quadrature points the interior FE objects
+   * were last reinitialized, or nullptr
+   */
+  const Elem * _elem_fe_elem;
+
+  /**
+   * Scratch space for copying FE data from a source
+   */
+  std::unique_ptr<FEAbstract::ReinitData> _shared_fe_data;
+
+  /**
+   * \returns An interior FE object of an FE data source which can
+   * stand in for our \p fe_type object on the current element, or
+   * nullptr if there is none.
+   */
+  const FEAbstract * shared_elem_fe(const FEType & fe_type) const;
+
+  /**
+   * \returns The cache entry for the interior (\p slot 0) or a side
+   * (\p slot side+1) of the current element, or nullptr if saved data
+   * should not be used there.
+   */
+  FEReinitCache::Entry * fe_reinit_cache_entry(unsigned int slot) const;
+
+  /**
+   * Restores the FE objects in \p fes from \p entry.
+   *
+   * \returns \p false, without changing anything, if \p entry does
+   * not hold data for the current element.
+   */
+  bool restore_fe_reinit_data(const FEReinitCache::Entry & entry,
+                              const std::map<FEType, std::unique_ptr<FEAbstract>> & fes) const;
+
+  /**
+   * Saves the FE objects in \p fes into \p entry.
+   */
+  void save_fe_reinit_data(FEReinitCache::Entry & entry,
+                           const std::map<FEType, std::unique_ptr<FEAbstract>> & fes) const;
+
+  /**
+   * Per-variable cache behind interior_values(unsigned int) and
+   * interior_gradients(unsigned int)
+   */
+  mutable std::vector<InteriorQpData> _interior_qp_data;
+
   template<typename OutputShape>
   FEGenericBase<OutputShape> * cached_fe( const unsigned int elem_dim,
                                           const FEType fe_type,
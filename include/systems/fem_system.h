@@ -26,13 +26,17 @@
 
 // C++ includes
 #include <cstddef>
+#include <vector>
 
 namespace libMesh
 {
 
 // Forward Declarations
 class DiffContext;
+class Elem;
+class FEMBatchAssembler;
 class FEMContext;
+class FEReinitCache;
 
 
 /**
@@ -110,6 +114,12 @@ public:
    */
   virtual void solve () override;
 
+  /**
+   * Reinitializes the member data fields associated with the system
+   * after a mesh change, and invalidates any cached element coloring.
+   */
+  virtual void reinit () override;
+
   /**
    * Tells the FEMSystem to set the degree of freedom coefficients
    * which should correspond to mesh nodal coordinates.
@@ -175,6 +185,236 @@ public:
    */
   bool fe_reinit_during_postprocess;
 
+  /**
+   * If colored_assembly is true (it is false by default), assembly()
+   * partitions the active local elements into colors such that no two
+   * elements of the same color share a global degree of freedom, and
+   * then assembles each color with Threads::parallel_for and no lock
+   * around the global matrix and residual insertion.
+   *
+   * Elements which touch non-local or constrained degrees of freedom
+   * (whose insertion may reach other rows via off-processor caches or
+   * constraint expansion) are still assembled with the lock, after
+   * all colors are finished.  Systems with SCALAR variables, which
+   * couple every element to each other, are always assembled with
+   * the lock.
+   *
+   * The coloring is computed on first use and cached until the
+   * DofMap is redistributed or its constraints are recomputed, or
+   * until clear_element_coloring() is called.
+   *
+   * Insertion without a lock requires that the matrix and vector
+   * implementations support concurrent insertion, e.g. PETSc
+   * configured with thread safety; see
+   * SparseMatrix::supports_concurrent_insertion().  Otherwise each
+   * color still computes its element contributions in parallel, but
+   * inserts them under the lock.
+   */
+  bool colored_assembly;
+
+  /**
+   * If grouped_assembly is true (it is false by default), assembly()
+   * visits the active local elements grouped by subdomain, element
+   * type and p-level, rather than in mesh order, so that each thread
+   * sees long runs of elements which need the same physics, finite
+   * element types and quadrature rules, and FE::reinit() can reuse
+   * its reference shape data between them.  Elements keep their mesh
+   * order within each group.
+   *
+   * This also orders the element lists used by colored_assembly and
+   * overlap_ghost_update.  The grouping is cached with the coloring,
+   * so changes to this flag take effect after the next reinit() or
+   * clear_element_coloring().
+   */
+  bool grouped_assembly;
+
+  /**
+   * If assembly_buffer_size is nonzero (it is zero by default), each
+   * assembly() thread stages its element jacobian and residual
+   * contributions in coordinate format, and inserts them into the
+   * global system with a single batched add_matrix() and add_vector()
+   * call whenever roughly assembly_buffer_size matrix (or residual)
+   * entries have accumulated.  This amortizes the assembly lock and
+   * the per-call overhead of the matrix and vector implementations
+   * over many elements, at the cost of the buffer memory.
+   *
+   * This may be combined with colored_assembly.
+   */
+  std::size_t assembly_buffer_size;
+
+  /**
+   * If overlap_ghost_update is true (it is false by default),
+   * assembly() brings current_local_solution up to date from
+   * solution itself, with begin_update() and end_update(), and
+   * assembles the elements whose degrees of freedom are all local
+   * and unconstrained while the ghost values are still in transit.
+   * The remaining elements are assembled after end_update().
+   *
+   * The solution must be closed before assembly().  Any time solver
+   * vectors other than the solution must already be up to date.
+   *
+   * This may be combined with colored_assembly, whose colored
+   * elements are exactly the ones which don't need ghost values.
+   */
+  bool overlap_ghost_update;
+
+  /**
+   * If cache_fe_reinit_data is true (it is false by default),
+   * assembly() saves the mapping and shape function data computed on
+   * each element and element side, and later assemblies restore it
+   * instead of recomputing it.  This trades memory for a cheaper
+   * assembly on each nonlinear iteration and time step.
+   *
+   * The saved data is discarded by reinit() after a mesh change, by
+   * mesh_position_set(), or by clear_fe_reinit_cache(), which must
+   * be called after moving the mesh in any other way.  It is never
+   * used by systems with a mesh system set, whose mesh moves during
+   * assembly.
+   */
+  bool cache_fe_reinit_data;
+
+  /**
+   * Discards the FE data saved when cache_fe_reinit_data is true.
+   */
+  void clear_fe_reinit_cache();
+
+  /**
+   * If residual_only_contexts is true (it is false by default),
+   * residual-only assembly() calls, such as those made by line
+   * searches, give the physics contexts whose element jacobian is
+   * left empty (see FEMContext::set_residual_only()), rather than
+   * allocating and zeroing an unused matrix on every element.
+   *
+   * This requires physics code which only touches the element
+   * jacobian when \p request_jacobian is true.  Heterogeneously
+   * constrained residuals still need the jacobian, so they always
+   * get it.
+   */
+  bool residual_only_contexts;
+
+  /**
+   * Attaches an assembler which computes element residuals and
+   * jacobians a batch at a time, e.g. on an accelerator.  While one is
+   * attached, assembly() gathers the solution and geometry of up to
+   * assembly_batch_size grouped_assembly-ordered elements at a time,
+   * has the assembler compute their contributions in place of the
+   * time solver, and then constrains and inserts those as usual.
+   * Pass nullptr to return to element-by-element assembly.
+   *
+   * The assembler is not owned by the system, and must outlive its
+   * use.  It takes precedence over colored_assembly and
+   * overlap_ghost_update; SCALAR variable terms are still computed by
+   * the time solver.
+   */
+  void attach_batch_assembler (FEMBatchAssembler * assembler)
+  { _batch_assembler = assembler; }
+
+  /**
+   * The largest number of elements in each batch given to an attached
+   * FEMBatchAssembler.  1024 by default.
+   */
+  std::size_t assembly_batch_size;
+
+  /**
+   * Assembles the residuals and/or jacobians of several \p systems on
+   * the same mesh, as their assembly() methods would, but in a single
+   * pass over the mesh: each element is visited once, and each
+   * system's physics is evaluated on it in turn, with its
+   * contributions going into its own matrix and rhs.
+   *
+   * Interior FE data computed for one system is copied into the FE
+   * objects of the later systems which have the same FE type and
+   * quadrature rule, rather than recomputed, so systems sharing FE
+   * types must request the same FE quantities in init_context().
+   *
+   * Each system's current_local_solution should be up to date.
+   * SCALAR variables are not supported, and the per-system assembly
+   * options (coloring, batching, FE caching etc.) are not used.
+   */
+  static void fused_assembly (const std::vector<FEMSystem *> & systems,
+                              bool get_residual,
+                              bool get_jacobian,
+                              bool apply_heterogeneous_constraints = false,
+                              bool apply_no_constraints = false);
+
+  /**
+   * Sets \p Jv to the product of the jacobian with \p v, computed
+   * element by element without assembling the jacobian matrix.
+   *
+   * The jacobian is linearized about current_local_solution, which
+   * should be up to date (e.g. via update()) before this is called.
+   * Constraints are applied as in assembly(), so the result matches
+   * the product of the assembled system matrix with \p v.
+   */
+  void assemble_jacobian_action (const NumericVector<Number> & v,
+                                 NumericVector<Number> & Jv);
+
+  /**
+   * Sets \p diagonal to the diagonal of the jacobian, without
+   * assembling the jacobian matrix.
+   */
+  void assemble_jacobian_diagonal (NumericVector<Number> & diagonal);
+
+  /**
+   * \returns \p true while assemble_jacobian_action() or
+   * assemble_jacobian_diagonal() is running.
+   *
+   * When the jacobian is applied matrix-free, any assembled system
+   * matrix is only used as a preconditioner; physics code can check
+   * this to skip expensive or hard-to-precondition terms whenever it
+   * is false.
+   */
+  bool computing_jacobian_action() const
+  { return _computing_jacobian_action; }
+
+  /**
+   * Discards any cached element coloring or interior element
+   * partition, so that the next colored or overlapped assembly()
+   * recomputes it.
+   */
+  void clear_element_coloring();
+
+  /**
+   * \returns The number of colors in the cached element coloring,
+   * or zero if no coloring has been computed.
+   */
+  unsigned int n_element_colors() const
+  { return cast_int<unsigned int>(_element_colors.size()); }
+
+  /**
+   * If colored_numerical_jacobian is true, numeric element jacobians
+   * perturb the same local dof of several variables at once whenever
+   * the DofMap coupling matrix shows that no residual variable
+   * couples to more than one of them, cutting the number of residual
+   * evaluations per element by up to a factor of the number of such
+   * variables.  Entries between uncoupled variables are then left
+   * zero, so this is only correct when the coupling matrix describes
+   * every coupling in the residual.
+   *
+   * This defaults to false.  It is ignored on moving meshes.
+   */
+  bool colored_numerical_jacobian;
+
+  /**
+   * If numerical_jacobian_one_sided is true, numeric jacobians use
+   * forward rather than central differences, taking one perturbed
+   * residual evaluation per column instead of two at the cost of
+   * first rather than second order accuracy in numerical_jacobian_h.
+   *
+   * This defaults to false.
+   */
+  bool numerical_jacobian_one_sided;
+
+  /**
+   * If ad_contexts is true (it is false by default), build_context()
+   * builds an ADFEMContext, whose dual number solution values let
+   * physics code get exact element jacobians from the same pass that
+   * computes their residuals.
+   *
+   * This requires MetaPhysicL support.
+   */
+  bool ad_contexts;
+
   /**
    * If calculating numeric jacobians is required, the FEMSystem
    * will perturb each solution vector entry by numerical_jacobian_h
@@ -255,7 +495,102 @@ protected:
   virtual void init_data () override;
 
 private:
+  /**
+   * Computes the greedy element coloring used by colored_assembly,
+   * if it has not already been computed for the current mesh.
+   */
+  void build_element_coloring();
+
+  /**
+   * Computes the split of the active local elements used by
+   * overlap_ghost_update, if it has not already been computed for
+   * the current mesh.
+   */
+  void build_element_partition();
+
+  /**
+   * Computes the grouped ordering of the active local elements used
+   * by grouped_assembly, if it has not already been computed for the
+   * current mesh.
+   */
+  void build_element_grouping();
+
+  /**
+   * Computes the element contributions in assembly() with the
+   * attached FEMBatchAssembler.
+   */
+  void batched_assembly (bool get_residual, bool get_jacobian,
+                         bool apply_heterogeneous_constraints,
+                         bool apply_no_constraints);
+
+  /**
+   * Adds the element jacobian actions on \p v, which must be
+   * localized to our ghosted dofs, to \p Jv, or the element jacobian
+   * diagonals if \p v is null.
+   */
+  void jacobian_action_contributions (const NumericVector<Number> * v,
+                                      NumericVector<Number> & Jv);
+
   std::vector<Real> _numerical_jacobian_h_for_var;
+
+  /**
+   * Active local elements, grouped so that no two elements of the
+   * same color share a global degree of freedom.
+   */
+  std::vector<std::vector<const Elem *>> _element_colors;
+
+  /**
+   * Active local elements which must be assembled with a lock
+   * around the global system insertion.
+   */
+  std::vector<const Elem *> _uncolored_elements;
+
+  /**
+   * Whether \p _element_colors and \p _uncolored_elements have been
+   * computed, and the DofMap::dof_serial_number() they were computed
+   * for.
+   */
+  bool _element_coloring_valid;
+  unsigned long _element_coloring_serial;
+
+  /**
+   * Active local elements which can be assembled without ghost
+   * values, and all the others.
+   */
+  std::vector<const Elem *> _interior_elements;
+  std::vector<const Elem *> _boundary_elements;
+
+  /**
+   * Whether \p _interior_elements and \p _boundary_elements have
+   * been computed, and the DofMap::dof_serial_number() they were
+   * computed for.
+   */
+  bool _element_partition_valid;
+  unsigned long _element_partition_serial;
+
+  /**
+   * Active local elements in grouped_assembly order, whether they
+   * have been computed, and the DofMap::dof_serial_number() they were
+   * computed for.
+   */
+  std::vector<const Elem *> _grouped_elements;
+  bool _element_grouping_valid;
+  unsigned long _element_grouping_serial;
+
+  /**
+   * The assembler attached by attach_batch_assembler(), if any
+   */
+  FEMBatchAssembler * _batch_assembler;
+
+  /**
+   * Whether we are currently computing a matrix-free jacobian action
+   */
+  bool _computing_jacobian_action;
+
+  /**
+   * FE data saved by assembly() when cache_fe_reinit_data is true
+   */
+  std::unique_ptr<FEReinitCache> _fe_reinit_cache;
 };
 
 // --------------------------------------------------------------
@@ -179,6 +179,29 @@ public:
    */
   unsigned int n_frequencies () const;
 
+  /**
+   * Sets whether, in a sweep over several frequencies, the initial
+   * guess at each frequency is linearly extrapolated from the
+   * solutions at the two previous ones.  Otherwise the iterative
+   * solver starts from whatever the solution vector holds after the
+   * user's solve function, typically the previous solution.
+   * Defaults to \p false.
+   */
+  void extrapolate_initial_guess (bool extrapolate)
+  { _extrapolate_initial_guess = extrapolate; }
+
+  /**
+   * Sets the number of consecutive frequencies of a sweep at which the
+   * preconditioner, e.g. a factorization, built at the previous
+   * frequency is reused, before it is rebuilt.  Neighboring
+   * frequencies give nearby operators, so an iterative solver
+   * preconditioned by a lagged factorization usually converges in a
+   * few iterations.  Defaults to 0, i.e. the preconditioner is rebuilt
+   * at every frequency.
+   */
+  void reuse_preconditioner_for (unsigned int n_reuse)
+  { _n_reuse_preconditioner = n_reuse; }
+
   /**
    * Register a required user function to use in assembling/solving the system.
    * It is intended to compute frequency-dependent data.  For proper
@@ -268,6 +291,17 @@ protected:
    */
   bool _finished_assemble;
 
+  /**
+   * Whether to extrapolate initial guesses in frequency sweeps.
+   */
+  bool _extrapolate_initial_guess;
+
+  /**
+   * The number of frequencies at which a preconditioner is reused
+   * before it is rebuilt.
+   */
+  unsigned int _n_reuse_preconditioner;
+
   /**
    * The number of iterations and the final residual
    * when the Ax=b is solved for multiple frequencies.
@@ -21,6 +21,8 @@
 #define GENERIC_PROJECTOR_H
 
 // C++ includes
+#include <cmath>
+#include <map>
 #include <vector>
 
 // libMesh includes
@@ -252,6 +254,23 @@ public:
     // Projections of C1 elements require a gradient as well
     std::unique_ptr<GFunctor> g;
 
+    // A factored projection matrix, with its coupling to fixed DoFs
+    // and the quadrature weights it was integrated with
+    struct ProjectionCacheEntry {
+      std::vector<Real> JxW;
+      DenseMatrix<Real> Kfree;
+      DenseMatrix<Real> Kfixed;
+    };
+
+    // Projection matrices, keyed by the fixed DoF pattern and shape
+    // function values they were built from.  On refined meshes these
+    // repeat for every child in the same position of the same parent
+    // type and FE, so each thread only factors each matrix once.
+    std::map<std::vector<Real>, ProjectionCacheEntry> projection_cache;
+
+    // Scratch space for building projection cache keys
+    std::vector<Real> projection_key;
+
     void construct_projection
       (const std::vector<dof_id_type> & dof_indices_var,
        const std::vector<unsigned int> & involved_dofs,
@@ -1963,6 +1982,20 @@ grad_component(const TensorValue<T> & grad, unsigned int component)
   return grad(component, component);
 }
 
+inline void
+append_projection_key(std::vector<Real> & key, Real shape)
+{
+  key.push_back(shape);
+}
+
+template <typename T>
+void
+append_projection_key(std::vector<Real> & key, const TypeVector<T> & shape)
+{
+  for (unsigned int d = 0; d != LIBMESH_DIM; ++d)
+    key.push_back(shape(d));
+}
+
 
 }
 
@@ -2967,18 +3000,17 @@ GenericProjector<FFunctor, GFunctor, FValue, ProjectionAction>::SubProjector::co
   if (!free_dofs)
     return;
 
-  // The element matrix and RHS for projections.
-  // Note that Ke is always real-valued, whereas
-  // Fe may be complex valued if complex number
+  const unsigned int n_qp =
+    cast_int<unsigned int>(xyz_values.size());
+
+  // The element RHS for projections.
+  // Note that the projection matrices are always real-valued,
+  // whereas Fe may be complex valued if complex number
   // support is enabled
-  DenseMatrix<Real> Ke(free_dofs, free_dofs);
   DenseVector<typename FFunctor::ValuePushType> Fe(free_dofs);
   // The new degree of freedom coefficients to solve for
   DenseVector<typename FFunctor::ValuePushType> Ufree(free_dofs);
 
-  const unsigned int n_qp =
-    cast_int<unsigned int>(xyz_values.size());
-
   // Loop over the quadrature points
   for (unsigned int qp=0; qp<n_qp; qp++)
     {
@@ -2997,7 +3029,6 @@ GenericProjector<FFunctor, GFunctor, FValue, ProjectionAction>::SubProjector::co
                                     system.time,
                                     false);
 
-      // Form edge projection matrix
       for (unsigned int sidei=0, freei=0;
            sidei != n_involved_dofs; ++sidei)
         {
@@ -3005,30 +3036,6 @@ GenericProjector<FFunctor, GFunctor, FValue, ProjectionAction>::SubProjector::co
           // fixed DoFs aren't test functions
           if (dof_is_fixed[sidei])
             continue;
-          for (unsigned int sidej=0, freej=0;
-               sidej != n_involved_dofs; ++sidej)
-            {
-              unsigned int j = involved_dofs[sidej];
-              if (dof_is_fixed[sidej])
-                Fe(freei) -= phi[i][qp] * phi[j][qp] *
-                  JxW[qp] * Uinvolved(sidej);
-              else
-                Ke(freei,freej) += phi[i][qp] *
-                  phi[j][qp] * JxW[qp];
-              if (cont == C_ONE)
-                {
-                  if (dof_is_fixed[sidej])
-                    Fe(freei) -= ( TensorTools::inner_product((*dphi)[i][qp],
-                                                              (*dphi)[j][qp]) ) *
-                      JxW[qp] * Uinvolved(sidej);
-                  else
-                    Ke(freei,freej) += ( TensorTools::inner_product((*dphi)[i][qp],
-                                                                    (*dphi)[j][qp]) )
-                      * JxW[qp];
-                }
-              if (!dof_is_fixed[sidej])
-                freej++;
-            }
           Fe(freei) += phi[i][qp] * fineval * JxW[qp];
           if (cont == C_ONE)
             Fe(freei) += (TensorTools::inner_product(finegrad,
@@ -3038,7 +3045,104 @@ GenericProjector<FFunctor, GFunctor, FValue, ProjectionAction>::SubProjector::co
         }
     }
 
-  Ke.cholesky_solve(Fe, Ufree);
+  // Without gradient terms the projection matrix depends only on
+  // the shape function values, the fixed DoFs and the quadrature
+  // weights; if we have seen the same shape functions before with
+  // proportional weights, as on affine elements, we can reuse that
+  // factored matrix and scale the RHS instead.
+  const std::size_t max_cached_projections = 64;
+  const bool cacheable = (cont != C_ONE && n_qp);
+  ProjectionCacheEntry * cached = nullptr;
+  ProjectionCacheEntry fresh;
+
+  if (cacheable)
+    {
+      projection_key.clear();
+      projection_key.push_back(n_involved_dofs);
+      projection_key.push_back(n_qp);
+      for (auto i : make_range(n_involved_dofs))
+        projection_key.push_back(dof_is_fixed[i]);
+      for (auto i : involved_dofs)
+        for (auto qp : make_range(n_qp))
+          append_projection_key(projection_key, phi[i][qp]);
+
+      auto it = projection_cache.find(projection_key);
+      if (it != projection_cache.end())
+        {
+          const std::vector<Real> & cached_JxW = it->second.JxW;
+          const Real JxW_scale = JxW[0] / cached_JxW[0];
+          bool proportional = true;
+          for (auto qp : make_range(n_qp))
+            if (std::abs(JxW[qp] - JxW_scale * cached_JxW[qp]) >
+                TOLERANCE * TOLERANCE * std::abs(JxW[qp]))
+              {
+                proportional = false;
+                break;
+              }
+
+          if (proportional)
+            {
+              cached = &it->second;
+              Fe.scale(1/JxW_scale);
+            }
+        }
+    }
+
+  if (!cached)
+    {
+      const unsigned int fixed_dofs = n_involved_dofs - free_dofs;
+      fresh.Kfree.resize(free_dofs, free_dofs);
+      fresh.Kfixed.resize(free_dofs, fixed_dofs);
+
+      // Form edge projection matrix
+      for (unsigned int qp=0; qp<n_qp; qp++)
+        for (unsigned int sidei=0, freei=0;
+             sidei != n_involved_dofs; ++sidei)
+          {
+            unsigned int i = involved_dofs[sidei];
+            // fixed DoFs aren't test functions
+            if (dof_is_fixed[sidei])
+              continue;
+            for (unsigned int sidej=0, freej=0, fixedj=0;
+                 sidej != n_involved_dofs; ++sidej)
+              {
+                unsigned int j = involved_dofs[sidej];
+                Real Kij = phi[i][qp] * phi[j][qp];
+                if (cont == C_ONE)
+                  Kij += TensorTools::inner_product((*dphi)[i][qp],
+                                                    (*dphi)[j][qp]);
+                if (dof_is_fixed[sidej])
+                  fresh.Kfixed(freei,fixedj++) += Kij * JxW[qp];
+                else
+                  fresh.Kfree(freei,freej++) += Kij * JxW[qp];
+              }
+            freei++;
+          }
+
+      if (cacheable &&
+          !projection_cache.count(projection_key) &&
+          projection_cache.size() < max_cached_projections)
+        {
+          fresh.JxW = JxW;
+          cached = &(projection_cache[projection_key] = std::move(fresh));
+        }
+      else
+        cached = &fresh;
+    }
+
+  // Move the fixed DoF contributions to the RHS
+  for (unsigned int sidej=0, fixedj=0;
+       sidej != n_involved_dofs; ++sidej)
+    if (dof_is_fixed[sidej])
+      {
+        for (auto freei : make_range(free_dofs))
+          Fe(freei) -= cached->Kfixed(freei,fixedj) * Uinvolved(sidej);
+        fixedj++;
+      }
+
+  // This factors Kfree the first time through and only back
+  // substitutes on reuse
+  cached->Kfree.cholesky_solve(Fe, Ufree);
 
   // Transfer new edge solutions to element
   const processor_id_type pid = node ?
@@ -32,6 +32,7 @@ namespace libMesh
 
 // Forward declarations
 template <typename T> class LinearSolver;
+class StaticCondensation;
 
 /**
  * \brief Manages consistently variables, degrees of freedom, coefficient
@@ -96,6 +97,13 @@ public:
    */
   virtual void clear () override;
 
+  /**
+   * Reinitializes the member data fields associated with
+   * the system, discarding any linear solver state which
+   * refers to the old mesh.
+   */
+  virtual void reinit () override;
+
   /**
    * Prepares \p matrix and \p rhs for system assembly, then calls
    * user assembly function.
@@ -325,6 +333,35 @@ public:
    */
   bool zero_out_matrix_and_rhs;
 
+  /**
+   * If true, adjoint_solve() keeps the preconditioner (e.g. the
+   * factorization) the linear solver last built for the system
+   * matrix, rather than building a new one for the adjoint operator;
+   * solvers supporting transpose solves, e.g. PETSc's via
+   * KSPSolveTranspose(), apply its transpose instead.  Where the
+   * forward solve and the adjoint solve share a linear solver, the
+   * adjoint solve thus reuses the forward factorization.  A mesh
+   * change still discards the preconditioner.
+   *
+   * Adjoint solutions are projected onto refined meshes and solves
+   * start from them, so between AMR cycles the previous adjoint
+   * solution is the initial guess either way.
+   *
+   * By default, this flag is false.
+   */
+  bool reuse_adjoint_preconditioner;
+
+  /**
+   * If true, the system matrix is built to store its values in single
+   * precision, which halves the memory traffic of each matrix-vector
+   * product in the linear solver while the solution stays in full
+   * precision.  This requires \p NATIVE_SOLVERS, and must be set
+   * before the system is initialized.
+   *
+   * By default, this flag is false.
+   */
+  bool single_precision_matrix;
+
   /**
    * This class handles all the details of interfacing with various
    * linear algebra packages like PETSc or LASPACK.  This is a public
@@ -335,11 +372,36 @@ public:
    */
   mutable std::unique_ptr<LinearSolver<Number>> linear_solver;
 
+  /**
+   * Enables static condensation of element interior dofs, e.g. the
+   * bubble functions of high order HIERARCHIC or BERNSTEIN
+   * variables, out of this system's linear solves; see
+   * StaticCondensation.
+   *
+   * FEMSystem condenses its element contributions automatically.
+   * Assembly functions for other systems should pass each element
+   * matrix and vector to get_static_condensation()->condense_element()
+   * before constraining them and adding them to the global system.
+   */
+  void enable_static_condensation ();
+
+  /**
+   * \returns The static condensation data of this system, or
+   * \p nullptr if static condensation has not been enabled.
+   */
+  StaticCondensation * get_static_condensation () const
+  { return _static_condensation.get(); }
+
 protected:
   /**
    * Adds the system matrix
    */
   virtual void add_matrices() override;
+
+  /**
+   * The static condensation data, if enabled.
+   */
+  std::unique_ptr<StaticCondensation> _static_condensation;
 };
 
 
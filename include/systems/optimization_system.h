@@ -134,6 +134,27 @@ public:
                           sys_type & S) = 0;
   };
 
+  /**
+   * Abstract base class to be used to apply the Hessian of an
+   * objective function without assembling it.
+   */
+  class ComputeHessianVectorProduct
+  {
+  public:
+    virtual ~ComputeHessianVectorProduct () {}
+
+    /**
+     * This function will be called to compute the product of the
+     * Hessian of the objective function at the iterate \p X with
+     * \p v, and must be implemented by the user in a derived
+     * class. Add the product to \p Hv, which has been zeroed.
+     */
+    virtual void hessian_vector_product (const NumericVector<Number> & X,
+                                         const NumericVector<Number> & v,
+                                         NumericVector<Number> & Hv,
+                                         sys_type & S) = 0;
+  };
+
   /**
    * Abstract base class to be used to calculate the equality constraints.
    */
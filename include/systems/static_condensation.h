@@ -0,0 +1,179 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_STATIC_CONDENSATION_H
+#define LIBMESH_STATIC_CONDENSATION_H
+
+// Local Includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/dense_matrix.h"
+#include "libmesh/dense_vector.h"
+#include "libmesh/id_types.h"
+#include "libmesh/threads.h"
+
+// C++ includes
+#include <unordered_map>
+#include <vector>
+
+namespace libMesh
+{
+
+// Forward Declarations
+class Elem;
+class System;
+template <typename T> class NumericVector;
+
+/**
+ * This class handles the static condensation of element interior
+ * degrees of freedom out of the linear solves of an ImplicitSystem.
+ *
+ * With high order continuous elements most of the dofs on each
+ * element are interior bubbles, coupled to nothing outside it.  While
+ * condensing, each element matrix is replaced by its Schur complement
+ * \f$ K_{bb} - K_{bi} K_{ii}^{-1} K_{ib} \f$ on the remaining
+ * "skeleton" dofs, plus an identity block for the interior dofs, and
+ * each element vector by \f$ F_b - K_{bi} K_{ii}^{-1} F_i \f$ on the
+ * skeleton.  After the linear solve, back_substitute() recovers the
+ * interior values element by element.
+ *
+ * The global dof numbering is unchanged, but the interior rows of the
+ * global matrix are decoupled identity rows, so that the linear solver
+ * and preconditioner only do real work on the skeleton.
+ *
+ * Interior dofs are the unconstrained dofs of continuous, non-SCALAR
+ * variables which are stored on an element, or on a node which lies on
+ * none of its sides.  Discontinuous variables, which are coupled
+ * through faces, are never condensed, and user coupling functors must
+ * not couple interior dofs to anything outside their element.
+ */
+class StaticCondensation
+{
+public:
+
+  /**
+   * Constructor.
+   */
+  explicit
+  StaticCondensation (const System & sys);
+
+  /**
+   * Condenses the element matrix \p K, if non-null, and the element
+   * vector \p F, if non-null, of \p elem, whose unconstrained dofs are
+   * \p dof_indices.  This should be called before constraints are
+   * applied to them, and does nothing unless condensing() is true.
+   *
+   * The factored interior block of \p K is kept for use by later
+   * calls with a null \p K, e.g. for residual-only assemblies with a
+   * lagged jacobian, and by back_substitute().  With a null \p K and
+   * no such data, \p F is left as it is.
+   *
+   * This may be called from multiple threads, for different
+   * elements.
+   */
+  void condense_element (const Elem & elem,
+                         const std::vector<dof_id_type> & dof_indices,
+                         DenseMatrix<Number> * K,
+                         DenseVector<Number> * F);
+
+  /**
+   * Overwrites the interior dofs of \p solution, which solves the
+   * condensed system with right hand side \p rhs, with the values
+   * solving the uncondensed system, using the element data from the
+   * last condensed assembly.
+   */
+  void back_substitute (const NumericVector<Number> & rhs,
+                        NumericVector<Number> & solution);
+
+  /**
+   * \returns \p true if element contributions should currently be
+   * condensed.  The system solvers set this while solving, so that
+   * other assemblies, e.g. for adjoint or sensitivity solves, see the
+   * uncondensed operators.
+   */
+  bool condensing () const
+  { return _condensing; }
+
+  /**
+   * Sets whether element contributions should currently be condensed.
+   */
+  void set_condensing (bool condensing)
+  { _condensing = condensing; }
+
+  /**
+   * Discards all element data.  This must be done whenever the mesh
+   * or the dof numbering changes.
+   */
+  void clear ();
+
+private:
+
+  /**
+   * The data needed to condense one element's contributions and to
+   * recover its interior solution.
+   */
+  struct ElemData
+  {
+    /**
+     * The element's unconstrained dofs, and the local indices of its
+     * interior and skeleton dofs among them.
+     */
+    std::vector<dof_id_type> dof_indices;
+    std::vector<unsigned int> interior, skeleton;
+
+    /**
+     * The LU factored interior block, the skeleton-interior block, and
+     * \f$ K_{ii}^{-1} K_{ib} \f$.
+     */
+    DenseMatrix<Number> Kii, Kbi, Kii_inv_Kib;
+  };
+
+  /**
+   * \returns The sorted global indices of the dofs of \p elem which
+   * can be condensed.
+   */
+  std::vector<dof_id_type> interior_dofs (const Elem & elem) const;
+
+  /**
+   * Factors the interior block of \p K into \p data, and overwrites
+   * \p K with its condensed form.
+   */
+  void condense_matrix (const Elem & elem,
+                        const std::vector<dof_id_type> & dof_indices,
+                        DenseMatrix<Number> & K,
+                        ElemData & data) const;
+
+  const System & _system;
+
+  bool _condensing;
+
+  /**
+   * Element data, by element id.
+   */
+  std::unordered_map<dof_id_type, ElemData> _elem_data;
+
+  /**
+   * Lock for access to \p _elem_data during threaded assembly.
+   */
+  Threads::spin_mutex _mutex;
+};
+
+} // namespace libMesh
+
+
+#endif // LIBMESH_STATIC_CONDENSATION_H
@@ -38,9 +38,11 @@
 namespace libMesh
 {
 enum FEMNormType : int;
+enum XdrMODE : int;
 }
 #else
 #include "libmesh/enum_norm_type.h"
+#include "libmesh/enum_xdr_mode.h"
 #endif
 
 // C++ includes
@@ -65,6 +67,7 @@ namespace libMesh
 class System;
 class EquationSystems;
 class MeshBase;
+class MemoryUsage;
 class Xdr;
 class DofMap;
 template <typename Output> class FunctionBase;
@@ -286,6 +289,14 @@ public:
    */
   virtual void reinit_constraints ();
 
+  /**
+   * Reinitializes the constraints for this system after only its
+   * Dirichlet boundary functions have changed, e.g. when they depend
+   * on \p time.  Hanging node and periodic constraints from the last
+   * reinit_constraints() are reused rather than recomputed.
+   */
+  virtual void reinit_dirichlet_constraints ();
+
   /**
    * \returns \p true iff this system has been initialized.
    */
@@ -297,6 +308,20 @@ public:
    */
   virtual void update ();
 
+  /**
+   * Split-phase version of \p update(): after \p begin_update()
+   * the entries of \p current_local_solution owned by this processor
+   * are up to date, and after \p end_update() the ghost entries are
+   * too.  Work which only reads owned entries can be done in
+   * between, overlapping it with the ghost value communication.
+   *
+   * This only overlaps anything for a \p GHOSTED \p
+   * current_local_solution; otherwise \p begin_update() calls \p
+   * update() and \p end_update() does nothing.
+   */
+  void begin_update ();
+  void end_update ();
+
   /**
    * Prepares \p matrix and \p _dof_map for matrix assembly.
    * Does not actually assemble anything.  For matrix assembly,
@@ -801,6 +826,28 @@ public:
                                       const bool projections=true,
                                       const ParallelType type = PARALLEL);
 
+  /**
+   * Adds the additional vector \p vec_name to this system without
+   * building it: the vector is only built and initialized to zero,
+   * like one from add_vector(), when it is first accessed through
+   * add_vector(), or through the non-const get_vector() or
+   * request_vector() by name.  Until then it takes no memory and
+   * costs nothing on reinit(), and it is not counted by n_vectors()
+   * or visited by the vector iterators, although have_vector() is
+   * true.
+   *
+   * This suits auxiliary vectors, such as adjoint right hand sides
+   * or sensitivities, which may never be used.  Such vectors are
+   * often scratch space, so by default they are zeroed rather than
+   * projected by reinit() once built.
+   *
+   * A \p PARALLEL vector can later be made \p GHOSTED by calling
+   * add_vector() with that type.
+   */
+  void add_lazy_vector (const std::string & vec_name,
+                        const bool projections=false,
+                        const ParallelType type = PARALLEL);
+
   /**
    * Removes the additional vector \p vec_name from this system
    */
@@ -814,6 +861,17 @@ public:
   bool & project_solution_on_reinit (void)
   { return _solution_projection; }
 
+  /**
+   * Tells the System whether or not matrices may keep their existing
+   * nonzero structure, and merely be zeroed, when the system is
+   * reinitialized if the new sparsity pattern is found to be
+   * identical to the old one.  Matrices are reallocated on every
+   * reinit() unless reuse_matrix_structure_on_reinit() = true is
+   * called.
+   */
+  bool & reuse_matrix_structure_on_reinit (void)
+  { return _reuse_matrix_structure; }
+
   /**
    * \returns \p true if this \p System has a vector associated with the
    * given name, \p false otherwise.
@@ -822,13 +880,16 @@ public:
 
   /**
    * \returns A const pointer to the vector if this \p System has a
-   * vector associated with the given name, \p nullptr otherwise.
+   * vector associated with the given name, \p nullptr otherwise, or
+   * if it is a vector from add_lazy_vector() which has not been built
+   * yet.
    */
   const NumericVector<Number> * request_vector (const std::string & vec_name) const;
 
   /**
    * \returns A pointer to the vector if this \p System has a
    * vector associated with the given name, \p nullptr otherwise.
+   * Builds a vector from add_lazy_vector() if necessary.
    */
   NumericVector<Number> * request_vector (const std::string & vec_name);
 
@@ -849,14 +910,16 @@ public:
   /**
    * \returns A const reference to this system's additional vector
    * named \p vec_name.  Access is only granted when the vector is already
-   * properly initialized.
+   * properly initialized; a vector from add_lazy_vector() has to be
+   * built by a non-const access first.
    */
   const NumericVector<Number> & get_vector (const std::string & vec_name) const;
 
   /**
    * \returns A writable reference to this system's additional vector
    * named \p vec_name.  Access is only granted when the vector is already
-   * properly initialized.
+   * properly initialized.  Builds a vector from add_lazy_vector() if
+   * necessary.
    */
   NumericVector<Number> & get_vector (const std::string & vec_name);
 
@@ -1358,12 +1421,57 @@ public:
   void write_parallel_data (Xdr & io,
                             const bool write_additional_data) const;
 
+  /**
+   * Writes a number of identically distributed vectors with one file
+   * per processor, named \p name followed by the processor id, e.g.
+   * "name.0003".  Each processor writes only its local values, tagged
+   * with the ids of the nodes and elements they belong to, so no data
+   * passes through processor 0.  The files can be read by
+   * read_distributed_vectors() on any number of processors and with
+   * any partitioning of the same mesh.
+   *
+   * \returns The number of values written by this processor.
+   */
+  std::size_t write_distributed_vectors (const std::string & name,
+                                         const XdrMODE mode,
+                                         const std::vector<const NumericVector<Number> *> & vectors) const;
+
+  /**
+   * Reads vectors written by write_distributed_vectors().  Each
+   * processor reads an interleaved subset of the files, and the values
+   * are then sent by node and element id, through a processor chosen
+   * by id range, to the processors which own them, so that no
+   * processor holds more than its share of the data.
+   *
+   * \returns The number of values set on this processor.
+   */
+  template <typename InValType>
+  std::size_t read_distributed_vectors (const std::string & name,
+                                        const XdrMODE mode,
+                                        const std::vector<NumericVector<Number> *> & vectors) const;
+
+  /**
+   * Non-templated version, for files written with the same Number
+   * type.
+   */
+  std::size_t read_distributed_vectors (const std::string & name,
+                                        const XdrMODE mode,
+                                        const std::vector<NumericVector<Number> *> & vectors) const
+  { return read_distributed_vectors<Number>(name, mode, vectors); }
+
   /**
    * \returns A string containing information about the
    * system.
    */
   std::string get_info () const;
 
+  /**
+   * \returns The memory held on this processor by each vector and
+   * matrix of the system, and by its \p DofMap.  Derived classes
+   * holding other large data should add it.
+   */
+  virtual MemoryUsage memory_usage () const;
+
   /**
    * Register a user function to use in initializing the system.
    */
@@ -1735,6 +1843,19 @@ public:
     project_with_constraints = _project_with_constraints;
   }
 
+  /**
+   * Setter and getter functions for project_with_matrix boolean
+   */
+  bool get_project_with_matrix() const
+  {
+    return project_with_matrix;
+  }
+
+  void set_project_with_matrix(bool _project_with_matrix)
+  {
+    project_with_matrix = _project_with_matrix;
+  }
+
   /**
    * \returns A writable reference to a boolean that determines if this system
    * can be written to file or not.  If set to \p true, then
@@ -1888,6 +2009,22 @@ protected:
                        NumericVector<Number> &,
                        int is_adjoint = -1) const;
 
+  /**
+   * Projects each of the vectors defined on the old mesh onto the
+   * new mesh, constraining the vector \p vectors[i] using the adjoint
+   * constraints for \p is_adjoint[i] if that is non-negative.
+   *
+   * Where possible (with MetaPhysicL available, no vector-valued
+   * variables, and no SERIAL vectors) a single projection pass
+   * computes each new DoF as a combination of old DoFs, which is then
+   * applied to every vector; otherwise this just calls
+   * project_vector() on each vector.  If project_with_matrix is set,
+   * those combinations are assembled into a SparseMatrix and applied
+   * to each vector as a matrix-vector product instead.
+   */
+  void project_vectors (const std::vector<NumericVector<Number> *> & vectors,
+                        const std::vector<int> & is_adjoint) const;
+
   /*
    * If we have e.g. a element space constrained by spline values, we
    * can directly project only on the constrained basis; to get
@@ -2133,6 +2270,13 @@ private:
    */
   std::map<std::string, ParallelType> _vector_types;
 
+  /**
+   * The vectors from add_lazy_vector() which have not been built
+   * yet.  Their projection flags and types are already in the maps
+   * above.
+   */
+  std::set<std::string> _lazy_vectors;
+
   /**
    * Some systems need an arbitrary number of matrices.
    */
@@ -2155,6 +2299,13 @@ private:
    */
   bool _solution_projection;
 
+  /**
+   * Holds true if matrices with an unchanged sparsity pattern should
+   * be zeroed rather than reallocated on reinit.  This is false by
+   * default.
+   */
+  bool _reuse_matrix_structure;
+
   /**
    * Holds true if the components of more advanced system types (e.g.
    * system matrices) should not be initialized.
@@ -2209,6 +2360,14 @@ private:
    * Do we want to apply constraints while projecting vectors ?
    */
   bool project_with_constraints;
+
+  /**
+   * Do we want to project vectors after a mesh change by building a
+   * projection matrix once and multiplying each vector by it?  This
+   * needs a linear algebra package whose matrices can be initialized
+   * without a sparsity pattern, such as PETSc.
+   */
+  bool project_with_matrix;
 };
 
 
@@ -2426,7 +2585,7 @@ dof_id_type System::n_active_dofs() const
 inline
 bool System::have_vector (const std::string & vec_name) const
 {
-  return (_vectors.count(vec_name));
+  return (_vectors.count(vec_name) || _lazy_vectors.count(vec_name));
 }
 
 
@@ -67,7 +67,7 @@ public:
 
     /**
      * Method that decides whether a given subdomain id is included in
-     * the subset or nor.
+     * the subset or nor.  This is called from multiple threads.
      */
     virtual bool operator() (const subdomain_id_type & subdomain_id) const = 0;
 
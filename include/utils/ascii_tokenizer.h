@@ -0,0 +1,263 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_ASCII_TOKENIZER_H
+#define LIBMESH_ASCII_TOKENIZER_H
+
+// Local Includes
+#include "libmesh/libmesh_common.h"
+
+// C++ Includes
+#include <algorithm>
+#include <cstddef>
+#include <cstdio> // EOF
+#include <istream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace libMesh
+{
+
+/**
+ * A buffered reader for ASCII mesh files.  It pulls large blocks from
+ * the buffer of an input stream and parses numbers directly from
+ * memory, which is much faster than extracting them one at a time
+ * with operator>>, std::getline() and std::stringstream.
+ *
+ * The interface follows the parts of std::istream the ASCII readers
+ * use: read() skips whitespace and extracts a value as operator>>
+ * would, peek(), get(), unget() and getline() behave like their
+ * istream counterparts, and a failed extraction sets the fail state
+ * rather than throwing.  Floating point values may also be written
+ * with a Fortran "D" exponent, as in UNV files.
+ *
+ * The tokenizer reads ahead, so the stream should not be used
+ * directly while the tokenizer is reading from it.
+ */
+class AsciiTokenizer
+{
+public:
+  /**
+   * Constructor.  Reads from \p in in blocks of \p block_size bytes.
+   */
+  explicit
+  AsciiTokenizer (std::istream & in,
+                  std::size_t block_size = 1 << 20);
+
+  /**
+   * Skips whitespace, then extracts a value.
+   *
+   * \returns \p true on success.  On failure the fail state is set
+   * and a numeric \p val is set to zero.
+   */
+  bool read (char & val);
+  bool read (signed char & val);
+  bool read (unsigned char & val);
+  bool read (short & val);
+  bool read (unsigned short & val);
+  bool read (int & val);
+  bool read (unsigned int & val);
+  bool read (long & val);
+  bool read (unsigned long & val);
+  bool read (long long & val);
+  bool read (unsigned long long & val);
+  bool read (float & val);
+  bool read (double & val);
+  bool read (long double & val);
+  bool read (std::string & val);
+
+  /**
+   * Any other numeric type, e.g. a quadruple precision Real, is
+   * extracted with operator>> from the next whitespace-delimited
+   * token.
+   */
+  template <typename T>
+  bool read (T & val);
+
+  /**
+   * \returns The next character without extracting it, or EOF.
+   */
+  int peek ();
+
+  /**
+   * Extracts the next character.
+   *
+   * \returns The character, or EOF.
+   */
+  int get ();
+
+  /**
+   * Puts back the last character extracted.
+   */
+  void unget ();
+
+  /**
+   * Extracts characters into \p line until \p delim, which is
+   * extracted but not stored, or the end of the input.
+   *
+   * \returns \p false if nothing could be extracted.
+   */
+  bool getline (std::string & line, char delim = '\n');
+
+  /**
+   * Extracts the rest of the line, storing as much of it as fits in
+   * the \p n characters of \p line, including the terminating null.
+   * Unlike std::istream::getline() a long line is truncated rather
+   * than setting the fail state.
+   */
+  bool getline (char * line, std::size_t n);
+
+  /**
+   * Extracts the rest of the line, including the newline.
+   */
+  void ignore_line ();
+
+  /**
+   * Extracts any of the characters in \p chars.
+   *
+   * \returns The next character, or EOF.
+   */
+  int skip_any (const char * chars);
+
+  /**
+   * Extracts characters up to, but not including, the first one
+   * found in \p chars.
+   *
+   * \returns That character, or EOF.
+   */
+  int skip_to_any (const char * chars);
+
+  bool eof () const { return _eof; }
+  bool fail () const { return _fail; }
+  bool good () const { return !_eof && !_fail; }
+  explicit operator bool () const { return !_fail; }
+
+  /**
+   * Resets the eof and fail states.
+   */
+  void clear () { _eof = _fail = false; }
+
+private:
+
+  /**
+   * Moves any unread data, and the last character read, to the front
+   * of the buffer and appends another block from the stream.
+   *
+   * \returns \p false if the stream had no more data.
+   */
+  bool fill ();
+
+  /**
+   * Skips whitespace and makes sure that the following word, up to
+   * the next whitespace, is entirely in the buffer.
+   *
+   * \returns \p false, setting the eof and fail states, if the input
+   * ends first.
+   */
+  bool load_word ();
+
+  /**
+   * Sets the eof state if a value just extracted ended the input, as
+   * operator>> would.
+   */
+  void check_eof ();
+
+  template <typename T>
+  bool read_integer (T & val);
+
+  template <typename T>
+  bool read_floating (T & val);
+
+  template <typename T>
+  bool read_character (T & val);
+
+  std::istream & _in;
+
+  const std::size_t _block_size;
+
+  /**
+   * The data read so far, followed by a null character so that the
+   * C library parsing functions stop at the end of the data.
+   */
+  std::vector<char> _buf;
+
+  std::size_t _pos, _end;
+
+  bool _exhausted, _eof, _fail;
+};
+
+
+
+// ------------------------------------------------------------
+// AsciiTokenizer inline and template member functions
+inline
+int AsciiTokenizer::peek ()
+{
+  if (_pos == _end && !this->fill())
+    {
+      _eof = true;
+      return EOF;
+    }
+
+  return static_cast<unsigned char>(_buf[_pos]);
+}
+
+
+
+inline
+int AsciiTokenizer::get ()
+{
+  if (_pos == _end && !this->fill())
+    {
+      _eof = _fail = true;
+      return EOF;
+    }
+
+  return static_cast<unsigned char>(_buf[_pos++]);
+}
+
+
+
+template <typename T>
+inline
+bool AsciiTokenizer::read (T & val)
+{
+  std::string token;
+  if (!this->read(token))
+    return false;
+
+  // Fortran "D" exponents
+  std::replace(token.begin(), token.end(), 'D', 'e');
+  std::replace(token.begin(), token.end(), 'd', 'e');
+
+  std::istringstream token_stream(token);
+  if (!(token_stream >> val))
+    {
+      _fail = true;
+      return false;
+    }
+
+  return true;
+}
+
+} // namespace libMesh
+
+
+#endif // LIBMESH_ASCII_TOKENIZER_H
@@ -0,0 +1,402 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_CONCURRENT_HASH_MAP_H
+#define LIBMESH_CONCURRENT_HASH_MAP_H
+
+// Local Includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/threads.h"
+
+// C++ Includes
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <functional> // std::hash
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace libMesh
+{
+
+/**
+ * An open-addressing hash map which allows concurrent insert() and
+ * find() calls, e.g. from the bodies of a Threads::parallel_for(),
+ * without locking.
+ *
+ * Each slot carries an atomic state.  An inserting thread claims the
+ * first empty slot in its key's probe sequence, writes the entry,
+ * and then publishes it; a thread probing past a claimed slot waits
+ * for it to be published before comparing keys.  So if \p Multi is
+ * false, concurrent insertions of the same key agree on a single
+ * entry, as in a std::unordered_map; if \p Multi is true every
+ * insertion adds an entry, as in a std::unordered_multimap.
+ *
+ * The table grows as needed in serial code, but cannot grow while
+ * other threads may be using it: call reserve() with the expected
+ * number of entries before inserting from threads.  Entries cannot
+ * be erased individually.
+ *
+ * Since the slot an entry lands in depends on the order of
+ * insertions, anything which numbers entries, such as new node ids,
+ * should use sorted_entries() rather than the insertion order to be
+ * deterministic.
+ */
+template <typename Key,
+          typename Value,
+          typename Hash = std::hash<Key>,
+          bool Multi = false>
+class ConcurrentHashMap
+{
+public:
+  ConcurrentHashMap () :
+    _capacity(0),
+    _shift(64),
+    _size(0)
+  {}
+
+  /**
+   * Copying is not thread-safe.
+   */
+  ConcurrentHashMap (const ConcurrentHashMap & other);
+  ConcurrentHashMap & operator= (const ConcurrentHashMap & other);
+
+  /**
+   * Grows the table, if necessary, so that \p n entries can be
+   * inserted without growing it again.  Not thread-safe.
+   */
+  void reserve (std::size_t n);
+
+  /**
+   * Removes every entry, keeping the allocated table.  Not
+   * thread-safe.
+   */
+  void clear ();
+
+  /**
+   * \returns The number of entries.  While insertions are under way
+   * this may also count some which will turn out to be duplicates.
+   */
+  std::size_t size () const { return _size.load(std::memory_order_relaxed); }
+
+  bool empty () const { return !this->size(); }
+
+  /**
+   * Inserts \p value under \p key, unless \p Multi is false and
+   * \p key is already present.
+   *
+   * \returns The value stored under \p key, and whether it was newly
+   * inserted.
+   */
+  std::pair<Value, bool> insert (const Key & key, const Value & value);
+
+  /**
+   * \returns A pointer to a value stored under \p key, or nullptr if
+   * there is none.
+   */
+  const Value * find (const Key & key) const;
+
+  /**
+   * Calls \p f on each value stored under \p key, until it returns
+   * true.
+   *
+   * \returns true if \p f did.
+   */
+  template <typename Functor>
+  bool find_if (const Key & key, Functor f) const;
+
+  /**
+   * \returns Every entry, sorted by key and then by value.
+   */
+  std::vector<std::pair<Key, Value>> sorted_entries () const;
+
+private:
+  enum : unsigned char { EMPTY = 0, CLAIMED, FULL };
+
+  struct Slot
+  {
+    std::atomic<unsigned char> state;
+    Key key;
+    Value value;
+  };
+
+  /**
+   * The first slot in the probe sequence of \p key.  Keys such as
+   * spatial bins hash to nearby integers, so the hash is scrambled by
+   * Fibonacci hashing before the top bits are taken.
+   */
+  std::size_t first_slot (const Key & key) const
+  {
+    const std::uint64_t h = static_cast<std::uint64_t>(Hash()(key));
+    return static_cast<std::size_t>((h * UINT64_C(11400714819323198485)) >> _shift);
+  }
+
+  std::size_t next_slot (std::size_t i) const
+  { return (i + 1) & (_capacity - 1); }
+
+  /**
+   * \returns The state of \p slot once it is no longer being written.
+   */
+  static unsigned char published_state (const Slot & slot)
+  {
+    unsigned char state = slot.state.load(std::memory_order_acquire);
+    while (state == CLAIMED)
+      state = slot.state.load(std::memory_order_acquire);
+    return state;
+  }
+
+  /**
+   * Reallocates the table with \p new_capacity slots, a power of
+   * two, and reinserts every entry.
+   */
+  void rehash (std::size_t new_capacity);
+
+  std::unique_ptr<Slot[]> _slots;
+
+  std::size_t _capacity;
+
+  /**
+   * 64 minus the log2 of the capacity.
+   */
+  unsigned int _shift;
+
+  std::atomic<std::size_t> _size;
+};
+
+
+
+// ------------------------------------------------------------
+// ConcurrentHashMap member functions
+template <typename Key, typename Value, typename Hash, bool Multi>
+inline
+ConcurrentHashMap<Key, Value, Hash, Multi>::ConcurrentHashMap (const ConcurrentHashMap & other) :
+  ConcurrentHashMap()
+{
+  *this = other;
+}
+
+
+
+template <typename Key, typename Value, typename Hash, bool Multi>
+inline
+ConcurrentHashMap<Key, Value, Hash, Multi> &
+ConcurrentHashMap<Key, Value, Hash, Multi>::operator= (const ConcurrentHashMap & other)
+{
+  if (this == &other)
+    return *this;
+
+  _slots.reset(other._capacity ? new Slot[other._capacity] : nullptr);
+  _capacity = other._capacity;
+  _shift = other._shift;
+  _size.store(other.size(), std::memory_order_relaxed);
+
+  for (std::size_t i = 0; i != _capacity; ++i)
+    {
+      const Slot & other_slot = other._slots[i];
+      _slots[i].state.store(other_slot.state.load(std::memory_order_relaxed),
+                            std::memory_order_relaxed);
+      _slots[i].key = other_slot.key;
+      _slots[i].value = other_slot.value;
+    }
+
+  return *this;
+}
+
+
+
+template <typename Key, typename Value, typename Hash, bool Multi>
+inline
+void ConcurrentHashMap<Key, Value, Hash, Multi>::reserve (std::size_t n)
+{
+  libmesh_assert(!Threads::in_threads);
+
+  // Keep the load factor at most 3/4, so probe sequences stay short
+  std::size_t new_capacity = 16;
+  while (new_capacity * 3 < n * 4)
+    new_capacity *= 2;
+
+  if (new_capacity > _capacity)
+    this->rehash(new_capacity);
+}
+
+
+
+template <typename Key, typename Value, typename Hash, bool Multi>
+inline
+void ConcurrentHashMap<Key, Value, Hash, Multi>::clear ()
+{
+  libmesh_assert(!Threads::in_threads);
+
+  for (std::size_t i = 0; i != _capacity; ++i)
+    _slots[i].state.store(EMPTY, std::memory_order_relaxed);
+
+  _size.store(0, std::memory_order_relaxed);
+}
+
+
+
+template <typename Key, typename Value, typename Hash, bool Multi>
+inline
+std::pair<Value, bool>
+ConcurrentHashMap<Key, Value, Hash, Multi>::insert (const Key & key,
+                                                    const Value & value)
+{
+  // Grow by doubling in serial code
+  if (!Threads::in_threads && (this->size() + 1) * 4 > _capacity * 3)
+    this->reserve(2 * (this->size() + 1));
+
+  // Count this entry before placing it, so that concurrent
+  // insertions can never fill the last empty slot, which ends every
+  // probe sequence.
+  const std::size_t old_size = _size.fetch_add(1, std::memory_order_relaxed);
+  if (old_size + 1 >= _capacity)
+    {
+      _size.fetch_sub(1, std::memory_order_relaxed);
+      libmesh_error_msg("ConcurrentHashMap is full; reserve() room for "
+                        << old_size + 1 << " entries before inserting from threads.");
+    }
+
+  for (std::size_t i = this->first_slot(key); ; i = this->next_slot(i))
+    {
+      Slot & slot = _slots[i];
+
+      unsigned char state = slot.state.load(std::memory_order_acquire);
+      if (state == EMPTY)
+        {
+          if (slot.state.compare_exchange_strong(state, CLAIMED,
+                                                 std::memory_order_acquire))
+            {
+              slot.key = key;
+              slot.value = value;
+              slot.state.store(FULL, std::memory_order_release);
+              return std::make_pair(value, true);
+            }
+
+          // Another thread claimed this slot first; it might be
+          // inserting the same key.
+        }
+
+      if (!Multi &&
+          published_state(slot) == FULL &&
+          slot.key == key)
+        {
+          _size.fetch_sub(1, std::memory_order_relaxed);
+          return std::make_pair(slot.value, false);
+        }
+    }
+}
+
+
+
+template <typename Key, typename Value, typename Hash, bool Multi>
+inline
+const Value *
+ConcurrentHashMap<Key, Value, Hash, Multi>::find (const Key & key) const
+{
+  const Value * found = nullptr;
+  this->find_if(key, [&found](const Value & value)
+                { found = &value; return true; });
+  return found;
+}
+
+
+
+template <typename Key, typename Value, typename Hash, bool Multi>
+template <typename Functor>
+inline
+bool ConcurrentHashMap<Key, Value, Hash, Multi>::find_if (const Key & key,
+                                                          Functor f) const
+{
+  if (!_capacity)
+    return false;
+
+  for (std::size_t i = this->first_slot(key); ; i = this->next_slot(i))
+    {
+      const Slot & slot = _slots[i];
+
+      if (published_state(slot) == EMPTY)
+        return false;
+
+      if (slot.key == key && f(slot.value))
+        return true;
+    }
+}
+
+
+
+template <typename Key, typename Value, typename Hash, bool Multi>
+inline
+std::vector<std::pair<Key, Value>>
+ConcurrentHashMap<Key, Value, Hash, Multi>::sorted_entries () const
+{
+  std::vector<std::pair<Key, Value>> entries;
+  entries.reserve(this->size());
+
+  for (std::size_t i = 0; i != _capacity; ++i)
+    if (published_state(_slots[i]) == FULL)
+      entries.emplace_back(_slots[i].key, _slots[i].value);
+
+  std::sort(entries.begin(), entries.end());
+
+  return entries;
+}
+
+
+
+template <typename Key, typename Value, typename Hash, bool Multi>
+inline
+void ConcurrentHashMap<Key, Value, Hash, Multi>::rehash (std::size_t new_capacity)
+{
+  libmesh_assert(!Threads::in_threads);
+  libmesh_assert(!(new_capacity & (new_capacity - 1)));
+
+  std::unique_ptr<Slot[]> old_slots(new Slot[new_capacity]);
+  std::swap(old_slots, _slots);
+  const std::size_t old_capacity = _capacity;
+
+  _capacity = new_capacity;
+  _shift = 64;
+  for (std::size_t c = new_capacity; c > 1; c /= 2)
+    --_shift;
+
+  for (std::size_t i = 0; i != _capacity; ++i)
+    _slots[i].state.store(EMPTY, std::memory_order_relaxed);
+
+  // Every old entry is distinct, so no key comparisons are needed
+  for (std::size_t i = 0; i != old_capacity; ++i)
+    {
+      const Slot & old_slot = old_slots[i];
+      if (old_slot.state.load(std::memory_order_relaxed) != FULL)
+        continue;
+
+      std::size_t j = this->first_slot(old_slot.key);
+      while (_slots[j].state.load(std::memory_order_relaxed) != EMPTY)
+        j = this->next_slot(j);
+
+      _slots[j].key = old_slot.key;
+      _slots[j].value = old_slot.value;
+      _slots[j].state.store(FULL, std::memory_order_relaxed);
+    }
+}
+
+} // namespace libMesh
+
+
+#endif // LIBMESH_CONCURRENT_HASH_MAP_H
@@ -0,0 +1,149 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_ELEM_CONTAINMENT_CACHE_H
+#define LIBMESH_ELEM_CONTAINMENT_CACHE_H
+
+// Local Includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/id_types.h"
+#include "libmesh/point.h"
+#include "libmesh/tensor_value.h"
+
+// C++ includes
+#include <vector>
+
+namespace libMesh
+{
+
+// Forward Declarations
+class Elem;
+
+/**
+ * This class stores per-element geometric data which speeds up
+ * repeated point containment tests against the same elements, as in
+ * a point locator.
+ *
+ * For each element added, the bounding box of its nodes is saved, so
+ * that points outside it are rejected without looking at the element
+ * again, and for elements with an affine Lagrange map the inverse of
+ * that map is saved, so that points inside the box are mapped to the
+ * reference element in closed form rather than by a Newton iteration.
+ * Other points are handed back to Elem::contains_point() or
+ * Elem::close_to_point(), which give the same answers the cache does.
+ *
+ * The saved data is only valid until the mesh is moved or modified.
+ */
+class ElemContainmentCache
+{
+public:
+
+  /**
+   * Saves the data for \p elem, replacing any already saved for an
+   * element with the same id.
+   */
+  void add (const Elem & elem);
+
+  /**
+   * Discards all saved data.
+   */
+  void clear () { _data.clear(); }
+
+  /**
+   * \returns The same as \p elem.contains_point(p, tol).
+   */
+  bool contains_point (const Elem & elem,
+                       const Point & p,
+                       Real tol = TOLERANCE) const;
+
+  /**
+   * \returns The same as \p elem.close_to_point(p, tol).
+   */
+  bool close_to_point (const Elem & elem,
+                       const Point & p,
+                       Real tol) const;
+
+  /**
+   * Fills \p reference_points with the locations on the reference
+   * element of \p elem of each of \p physical_points, as
+   * FEMap::inverse_map() would, in closed form if \p elem has an
+   * affine map.
+   */
+  void inverse_map (const Elem & elem,
+                    const std::vector<Point> & physical_points,
+                    std::vector<Point> & reference_points) const;
+
+private:
+
+  struct ElemData
+  {
+    /**
+     * The element the data was saved for, or nullptr
+     */
+    const Elem * elem = nullptr;
+
+    /**
+     * The bounding box of the element's nodes, which bounds the
+     * element itself if \p has_box is true, and the element's hmax()
+     */
+    Point min, max;
+    Real hmax = 0;
+    bool has_box = false;
+
+    /**
+     * For an affine element, the physical location of the reference
+     * origin, the map Jacobian, whose first dim() columns are the
+     * images of the reference unit vectors, and its (pseudo-)inverse
+     */
+    bool affine = false;
+    Point origin;
+    RealTensor jacobian;
+    RealTensor inverse_jacobian;
+  };
+
+  /**
+   * \returns The data saved for \p elem, or nullptr.
+   */
+  const ElemData * data (const Elem & elem) const;
+
+  /**
+   * \returns The reference location of \p p on the affine element
+   * described by \p data.
+   */
+  static Point affine_inverse_map (const ElemData & data,
+                                   const Point & p);
+
+  /**
+   * The shared implementation of contains_point() and
+   * close_to_point(), with the same tolerances as Elem uses.
+   */
+  bool point_test (const Elem & elem, const Point & p,
+                   Real box_tol, Real map_tol,
+                   bool close_to) const;
+
+  /**
+   * Saved data, by element id
+   */
+  std::vector<ElemData> _data;
+};
+
+} // namespace libMesh
+
+
+#endif // LIBMESH_ELEM_CONTAINMENT_CACHE_H
@@ -0,0 +1,394 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_FLAT_MULTIMAP_H
+#define LIBMESH_FLAT_MULTIMAP_H
+
+// libMesh includes
+#include "libmesh/libmesh_common.h"
+
+// C++ Includes   -----------------------------------
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace libMesh
+{
+
+/**
+ * This \p flat_multimap templated class stores key/value pairs in
+ * sorted vectors, with the lookup and iteration interface of a
+ * std::multimap, for large maps where the per-entry node overhead of
+ * a std::multimap matters more than the cost of insertion.
+ *
+ * Unlike \p vectormap, lookups never modify the container, so
+ * several threads may query it at once, and insertions and lookups
+ * may be interleaved freely.  New entries go into a small sorted
+ * vector which is merged into the main one once it grows past the
+ * square root of the map size; erased entries in the main vector are
+ * only flagged, and are compacted away once they make up half of it.
+ * Entries with equal keys stay in insertion order, as in a
+ * std::multimap.
+ *
+ * Iterators are constant, and are invalidated by any modification.
+ */
+template <typename Key, typename Tp, typename Compare = std::less<Key>>
+class flat_multimap
+{
+public:
+
+  typedef Key                     key_type;
+  typedef Tp                      mapped_type;
+  typedef std::pair<Key, Tp>      value_type;
+  typedef std::vector<value_type> vector_type;
+  typedef std::size_t             size_type;
+
+  /**
+   * Forward iterator merging the main and recent entries in key
+   * order and skipping erased entries.
+   */
+  class const_iterator
+  {
+  public:
+    typedef std::forward_iterator_tag iterator_category;
+    typedef typename flat_multimap::value_type value_type;
+    typedef std::ptrdiff_t            difference_type;
+    typedef const value_type *        pointer;
+    typedef const value_type &        reference;
+
+    const_iterator() = default;
+
+    reference operator* () const
+    { return this->from_main() ? _map->_main[_i] : _map->_recent[_j]; }
+
+    pointer operator-> () const
+    { return &(**this); }
+
+    const_iterator & operator++ ()
+    {
+      if (this->from_main())
+        {
+          ++_i;
+          this->skip_erased();
+        }
+      else
+        ++_j;
+      return *this;
+    }
+
+    const_iterator operator++ (int)
+    {
+      const_iterator old = *this;
+      ++(*this);
+      return old;
+    }
+
+    bool operator== (const const_iterator & other) const
+    { return _i == other._i && _j == other._j; }
+
+    bool operator!= (const const_iterator & other) const
+    { return !(*this == other); }
+
+  private:
+    friend class flat_multimap;
+
+    const_iterator(const flat_multimap * map,
+                   size_type i, size_type i_end,
+                   size_type j, size_type j_end) :
+      _map(map), _i(i), _i_end(i_end), _j(j), _j_end(j_end)
+    { this->skip_erased(); }
+
+    // Older entries come first among equal keys
+    bool from_main() const
+    {
+      return _j == _j_end ||
+        (_i != _i_end &&
+         !_map->_comp(_map->_recent[_j].first, _map->_main[_i].first));
+    }
+
+    void skip_erased()
+    {
+      while (_i != _i_end && _map->_erased[_i])
+        ++_i;
+    }
+
+    const flat_multimap * _map = nullptr;
+    size_type _i = 0, _i_end = 0, _j = 0, _j_end = 0;
+  };
+
+  typedef const_iterator iterator;
+
+  flat_multimap() = default;
+
+  const_iterator begin() const
+  { return const_iterator(this, 0, _main.size(), 0, _recent.size()); }
+
+  const_iterator end() const
+  {
+    return const_iterator(this, _main.size(), _main.size(),
+                          _recent.size(), _recent.size());
+  }
+
+  /**
+   * \returns The number of entries.
+   */
+  size_type size() const
+  { return _main.size() - _n_erased + _recent.size(); }
+
+  bool empty() const
+  { return this->size() == 0; }
+
+  void clear()
+  {
+    _main.clear();
+    _erased.clear();
+    _recent.clear();
+    _n_erased = 0;
+  }
+
+  /**
+   * Releases any memory held for erased entries or future growth.
+   */
+  void shrink_to_fit()
+  {
+    this->merge();
+    _main.shrink_to_fit();
+    _erased.shrink_to_fit();
+  }
+
+  /**
+   * \returns The heap memory held by the map, including any held for
+   * erased entries or future growth.
+   */
+  std::size_t memory_usage() const
+  {
+    return (_main.capacity() + _recent.capacity()) * sizeof(value_type) +
+      _erased.capacity() / 8;
+  }
+
+  /**
+   * Inserts \p x after any entries with an equal key.
+   */
+  void insert (const value_type & x)
+  {
+    _recent.insert(std::upper_bound(_recent.begin(), _recent.end(),
+                                    x, FirstOrder(_comp)),
+                   x);
+    if (_recent.size() > min_recent &&
+        _recent.size() * _recent.size() > _main.size())
+      this->merge();
+  }
+
+  template <typename K, typename V>
+  void emplace (K && key, V && val)
+  { this->insert(value_type(std::forward<K>(key), std::forward<V>(val))); }
+
+  /**
+   * \returns The range of entries with key \p key.
+   */
+  std::pair<const_iterator, const_iterator>
+  equal_range (const key_type & key) const
+  {
+    const auto main_range = this->main_range(key);
+    const auto recent_range = this->recent_range(key);
+    return std::make_pair
+      (const_iterator(this, main_range.first, main_range.second,
+                      recent_range.first, recent_range.second),
+       const_iterator(this, main_range.second, main_range.second,
+                      recent_range.second, recent_range.second));
+  }
+
+  size_type count (const key_type & key) const
+  {
+    const auto rng = this->equal_range(key);
+    return cast_int<size_type>(std::distance(rng.first, rng.second));
+  }
+
+  /**
+   * Erases every entry with key \p key.
+   *
+   * \returns The number of entries erased.
+   */
+  size_type erase (const key_type & key)
+  {
+    return this->erase_if(key, [](const mapped_type &) { return true; });
+  }
+
+  /**
+   * Erases the entries with key \p key whose values satisfy \p pred.
+   *
+   * \returns The number of entries erased.
+   */
+  template <typename Pred>
+  size_type erase_if (const key_type & key, Pred pred)
+  {
+    const size_type old_size = this->size();
+
+    const auto main_range = this->main_range(key);
+    for (size_type i = main_range.first; i != main_range.second; ++i)
+      this->flag_if(i, pred);
+
+    const auto recent_range = this->recent_range(key);
+    _recent.erase(std::remove_if(_recent.begin() + recent_range.first,
+                                 _recent.begin() + recent_range.second,
+                                 [&pred](const value_type & pr)
+                                 { return pred(pr.second); }),
+                  _recent.begin() + recent_range.second);
+
+    this->compact_if_sparse();
+    return old_size - this->size();
+  }
+
+  /**
+   * Erases every entry whose value satisfies \p pred.
+   *
+   * \returns The number of entries erased.
+   */
+  template <typename Pred>
+  size_type erase_if (Pred pred)
+  {
+    const size_type old_size = this->size();
+
+    for (size_type i = 0, n = _main.size(); i != n; ++i)
+      this->flag_if(i, pred);
+
+    _recent.erase(std::remove_if(_recent.begin(), _recent.end(),
+                                 [&pred](const value_type & pr)
+                                 { return pred(pr.second); }),
+                  _recent.end());
+
+    this->compact_if_sparse();
+    return old_size - this->size();
+  }
+
+private:
+
+  /**
+   * Strict weak ordering, based solely on first element in a pair.
+   */
+  struct FirstOrder
+  {
+    FirstOrder(const Compare & c) : comp(c) {}
+
+    bool operator()(const value_type & lhs, const value_type & rhs) const
+    { return comp(lhs.first, rhs.first); }
+    bool operator()(const value_type & lhs, const key_type & rhs) const
+    { return comp(lhs.first, rhs); }
+    bool operator()(const key_type & lhs, const value_type & rhs) const
+    { return comp(lhs, rhs.first); }
+
+    const Compare & comp;
+  };
+
+  template <typename Pred>
+  void flag_if (size_type i, Pred & pred)
+  {
+    if (!_erased[i] && pred(_main[i].second))
+      {
+        _erased[i] = true;
+        ++_n_erased;
+      }
+  }
+
+  std::pair<size_type, size_type> main_range (const key_type & key) const
+  {
+    const auto rng = std::equal_range(_main.begin(), _main.end(), key,
+                                      FirstOrder(_comp));
+    return std::make_pair(size_type(rng.first - _main.begin()),
+                          size_type(rng.second - _main.begin()));
+  }
+
+  std::pair<size_type, size_type> recent_range (const key_type & key) const
+  {
+    const auto rng = std::equal_range(_recent.begin(), _recent.end(), key,
+                                      FirstOrder(_comp));
+    return std::make_pair(size_type(rng.first - _recent.begin()),
+                          size_type(rng.second - _recent.begin()));
+  }
+
+  void compact_if_sparse()
+  {
+    if (2 * _n_erased > _main.size())
+      this->merge();
+  }
+
+  /**
+   * Moves the recent entries into the main vector and drops erased
+   * entries from it.
+   */
+  void merge()
+  {
+    vector_type merged;
+    merged.reserve(this->size());
+
+    auto recent_it = _recent.begin();
+    const FirstOrder order(_comp);
+    for (size_type i = 0, n = _main.size(); i != n; ++i)
+      {
+        if (_erased[i])
+          continue;
+        // Only strictly smaller keys from the recent entries precede
+        // an older entry
+        while (recent_it != _recent.end() && order(*recent_it, _main[i]))
+          merged.push_back(std::move(*recent_it++));
+        merged.push_back(std::move(_main[i]));
+      }
+    std::move(recent_it, _recent.end(), std::back_inserter(merged));
+
+    _main.swap(merged);
+    _erased.assign(_main.size(), false);
+    _recent.clear();
+    _n_erased = 0;
+  }
+
+  /**
+   * The number of recent entries kept before merging, however small
+   * the map.
+   */
+  static const size_type min_recent = 64;
+
+  /**
+   * The bulk of the entries, sorted by key.
+   */
+  vector_type _main;
+
+  /**
+   * Flags for the entries of \p _main which have been erased.
+   */
+  std::vector<bool> _erased;
+
+  /**
+   * The number of entries flagged in \p _erased.
+   */
+  size_type _n_erased = 0;
+
+  /**
+   * Entries inserted since the last merge, sorted by key.
+   */
+  vector_type _recent;
+
+  Compare _comp;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_FLAT_MULTIMAP_H
@@ -24,10 +24,10 @@
 
 // Local Includes
 #include "libmesh/libmesh_common.h"
+#include "libmesh/concurrent_hash_map.h"
 #include "libmesh/point.h"
 
 // C++ Includes
-#include <unordered_map>
 #include <vector>
 
 namespace libMesh
@@ -42,8 +42,9 @@ class Node;
 /**
  * Data structures that enable location-based lookups
  * The key is a hash of the Point location.
- * For efficiency we will use a hashed multimap if it is
- * available, otherwise a regular multimap.
+ * The map is a ConcurrentHashMap, so once it has been initialized and
+ * pre-sized with reserve(), insert() and find() may be called
+ * concurrently from the bodies of a Threads::parallel_for().
  *
  * \author Roy Stogner
  * \date 2008
@@ -52,12 +53,18 @@ class Node;
 template <typename T>
 class LocationMap
 {
-  typedef std::unordered_multimap<unsigned int, T *> map_type;
+  typedef ConcurrentHashMap<unsigned int, T *, std::hash<unsigned int>, true> map_type;
 public:
   void init(MeshBase &);
 
   void clear() { _map.clear(); }
 
+  /**
+   * Pre-sizes the map for \p n objects in total, as is required
+   * before inserting from multiple threads.
+   */
+  void reserve(std::size_t n) { _map.reserve(n); }
+
   void insert(T &);
 
   bool empty() const { return _map.empty(); }
@@ -68,7 +75,7 @@ public:
   Point point_of(const T &) const;
 
 protected:
-  unsigned int key(const Point &);
+  unsigned int key(const Point &) const;
 
   void fill(MeshBase &);
 
@@ -17,10 +17,13 @@
 
 
 
+
 #ifndef LIBMESH_MAPVECTOR_H
 #define LIBMESH_MAPVECTOR_H
 
 // C++ Includes   -----------------------------------
+#include <array>
+#include <cstddef>
 #include <map>
 
 namespace libMesh
@@ -32,110 +35,186 @@ namespace libMesh
  * closely resembling that of a std::vector, for use with
  * DistributedMesh.
  *
+ * Pointers are stored in fixed-size chunks of consecutive indices,
+ * kept in a std::map keyed by chunk.  Ids on a distributed mesh are
+ * mostly contiguous, so lookups search a tree a chunk's size times
+ * smaller than one entry per object would need, and iteration walks
+ * contiguous arrays.  As with a std::map, inserting never invalidates
+ * iterators, and erasing only invalidates iterators to the erased
+ * entry.  Missing entries read as nullptr, and iteration skips
+ * nullptr entries.
+ *
  * \author  Roy H. Stogner
  */
 
 template <typename Val, typename index_t=unsigned int>
-class mapvector : public std::map<index_t, Val>
+class mapvector
 {
 public:
-  typedef std::map<index_t, Val> maptype;
+  /**
+   * The number of consecutive indices stored together.
+   */
+  static const std::size_t chunk_size = 32;
+
+  typedef std::array<Val, chunk_size> chunk_type;
+  typedef std::map<index_t, chunk_type> maptype;
 
   Val & operator[] (const index_t & k)
   {
-    return maptype::operator[](k);
+    return _chunks[k / chunk_size][k % chunk_size];
   }
   Val operator[] (const index_t & k) const
   {
-    typename maptype::const_iterator it = this->find(k);
-    return it == this->end().it? Val() : it->second;
+    typename maptype::const_iterator it = _chunks.find(k / chunk_size);
+    return it == _chunks.end() ? Val() : it->second[k % chunk_size];
   }
 
-  class veclike_iterator
+  /**
+   * Iterator over the non-null entries of a mapvector, in index
+   * order.
+   */
+  template <typename MapIter, typename Ref>
+  class iterator_base
   {
   public:
-    veclike_iterator(const typename maptype::iterator & i)
-      : it(i) {}
+    iterator_base(const MapIter & chunk, const MapIter & chunk_end)
+      : _chunk(chunk), _chunk_end(chunk_end), _i(0)
+    { this->skip_null(); }
 
-    veclike_iterator(const veclike_iterator & i) = default;
+    Ref operator*() const { return _chunk->second[_i]; }
 
-    Val & operator*() const { return it->second; }
-
-    veclike_iterator & operator++() { ++it; return *this; }
+    iterator_base & operator++()
+    {
+      this->advance();
+      this->skip_null();
+      return *this;
+    }
 
-    veclike_iterator operator++(int) {
-      veclike_iterator i = *this;
+    iterator_base operator++(int)
+    {
+      iterator_base i = *this;
       ++(*this);
       return i;
     }
 
-    bool operator==(const veclike_iterator & other) const {
-      return it == other.it;
+    bool operator==(const iterator_base & other) const
+    { return _chunk == other._chunk && _i == other._i; }
+
+    bool operator!=(const iterator_base & other) const
+    { return !(*this == other); }
+
+    /**
+     * \returns The index of the current entry.
+     */
+    index_t index() const
+    { return index_t(_chunk->first * chunk_size + _i); }
+
+  private:
+    template <typename, typename> friend class iterator_base;
+    friend class mapvector;
+
+    void advance()
+    {
+      if (++_i == chunk_size)
+        {
+          _i = 0;
+          ++_chunk;
+        }
     }
 
-    bool operator!=(const veclike_iterator & other) const {
-      return it != other.it;
+    void skip_null()
+    {
+      while (_chunk != _chunk_end && !_chunk->second[_i])
+        this->advance();
     }
 
-    typename maptype::iterator it;
-  };
+    MapIter _chunk, _chunk_end;
+    std::size_t _i;
 
-  class const_veclike_iterator
-  {
   public:
-    const_veclike_iterator(const typename maptype::const_iterator & i)
-      : it(i) {}
-
-    const_veclike_iterator(const const_veclike_iterator & i)
-      : it(i.it) {}
-
-    const_veclike_iterator(const veclike_iterator & i)
-      : it(i.it) {}
-
-    const Val & operator*() const { return it->second; }
-
-    const_veclike_iterator & operator++() { ++it; return *this; }
-
-    const_veclike_iterator operator++(int) {
-      veclike_iterator i = *this;
-      ++(*this);
-      return i;
-    }
-
-    bool operator==(const const_veclike_iterator & other) const {
-      return it == other.it;
-    }
-
-    bool operator!=(const const_veclike_iterator & other) const {
-      return it != other.it;
-    }
-
-    typename maptype::const_iterator it;
+    // Allow conversion from mutable to const iterators
+    template <typename OtherIter, typename OtherRef>
+    iterator_base(const iterator_base<OtherIter, OtherRef> & other)
+      : _chunk(other._chunk), _chunk_end(other._chunk_end), _i(other._i) {}
   };
 
+  typedef iterator_base<typename maptype::iterator, Val &> veclike_iterator;
+  typedef iterator_base<typename maptype::const_iterator, const Val &> const_veclike_iterator;
+
   void erase(index_t i) {
-    maptype::erase(i);
+    typename maptype::iterator it = _chunks.find(i / chunk_size);
+    if (it != _chunks.end())
+      {
+        it->second[i % chunk_size] = Val();
+        this->erase_if_empty(it);
+      }
   }
 
   veclike_iterator erase(const veclike_iterator & pos) {
-    return veclike_iterator(maptype::erase(pos.it));
+    *pos = Val();
+    veclike_iterator next = pos;
+    ++next;
+    // If pos's chunk is now empty then next has already left it
+    this->erase_if_empty(pos._chunk);
+    return next;
   }
 
   veclike_iterator begin() {
-    return veclike_iterator(maptype::begin());
+    return veclike_iterator(_chunks.begin(), _chunks.end());
   }
 
   const_veclike_iterator begin() const {
-    return const_veclike_iterator(maptype::begin());
+    return const_veclike_iterator(_chunks.begin(), _chunks.end());
   }
 
   veclike_iterator end() {
-    return veclike_iterator(maptype::end());
+    return veclike_iterator(_chunks.end(), _chunks.end());
   }
 
   const_veclike_iterator end() const {
-    return const_veclike_iterator(maptype::end());
+    return const_veclike_iterator(_chunks.end(), _chunks.end());
+  }
+
+  bool empty() const { return this->begin() == this->end(); }
+
+  void clear() { _chunks.clear(); }
+
+  /**
+   * \returns One past the largest index of a non-null entry, or 0 if
+   * there are none.
+   */
+  index_t end_index() const
+  {
+    for (typename maptype::const_reverse_iterator rit = _chunks.rbegin();
+         rit != _chunks.rend(); ++rit)
+      for (std::size_t i = chunk_size; i != 0; --i)
+        if (rit->second[i-1])
+          return index_t(rit->first * chunk_size + i);
+
+    return 0;
   }
+
+  /**
+   * \returns The estimated heap memory held by the container: one
+   * tree node, with three links and a color, per chunk.
+   */
+  std::size_t memory_usage() const
+  {
+    return _chunks.size() *
+      (sizeof(typename maptype::value_type) + 4 * sizeof(void *));
+  }
+
+private:
+
+  void erase_if_empty(typename maptype::iterator it)
+  {
+    for (const Val & v : it->second)
+      if (v)
+        return;
+    _chunks.erase(it);
+  }
+
+  maptype _chunks;
 };
 
 } // namespace libMesh
@@ -0,0 +1,150 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_MEMORY_USAGE_H
+#define LIBMESH_MEMORY_USAGE_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+
+// C++ includes
+#include <cstddef>
+#include <map>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace libMesh
+{
+
+// Forward declarations
+namespace Parallel {
+class Communicator;
+}
+
+/**
+ * The \p MemoryUsage class holds the number of bytes used on this
+ * processor by each component of a data structure, as returned by
+ * \p MeshBase::memory_usage(), \p DofMap::memory_usage() and
+ * \p System::memory_usage().
+ *
+ * The counts are estimates: they include the objects and containers
+ * which dominate memory use for large problems, with container
+ * overhead estimated from typical standard library node layouts,
+ * but not small per-object bookkeeping.
+ *
+ * \brief Byte counts by component.
+ */
+class MemoryUsage
+{
+public:
+
+  /**
+   * Adds \p bytes to the count for \p component.
+   */
+  void add (const std::string & component,
+            std::size_t bytes)
+  { _bytes[component] += bytes; }
+
+  /**
+   * Adds each component of \p other, with its name prefixed by
+   * \p prefix and a slash.
+   */
+  void add (const std::string & prefix,
+            const MemoryUsage & other);
+
+  /**
+   * \returns The count for \p component, or zero if there is none.
+   */
+  std::size_t get (const std::string & component) const;
+
+  /**
+   * \returns The sum of the counts for every component.
+   */
+  std::size_t total () const;
+
+  /**
+   * \returns The counts, by component name.
+   */
+  const std::map<std::string, std::size_t> & components () const
+  { return _bytes; }
+
+  /**
+   * Prints a table of the count for each component on this
+   * processor, along with its minimum, maximum and total over every
+   * processor in \p comm.  Collective on \p comm; only processor 0
+   * prints.
+   */
+  void print (std::ostream & os,
+              const Parallel::Communicator & comm) const;
+
+  /**
+   * \returns The heap memory held by a std::vector.
+   */
+  template <typename T, typename A>
+  static std::size_t heap_size (const std::vector<T, A> & v)
+  { return v.capacity() * sizeof(T); }
+
+  /**
+   * \returns The estimated heap memory held by a std::set or
+   * std::map: one tree node, with three links and a color, per
+   * entry.
+   */
+  template <typename K, typename C, typename A>
+  static std::size_t heap_size (const std::set<K, C, A> & s)
+  { return s.size() * (sizeof(K) + tree_node_overhead); }
+
+  template <typename K, typename T, typename C, typename A>
+  static std::size_t heap_size (const std::map<K, T, C, A> & m)
+  { return m.size() * (sizeof(std::pair<const K, T>) + tree_node_overhead); }
+
+  /**
+   * \returns The estimated heap memory held by a std::unordered_set
+   * or std::unordered_map: one singly linked node per entry, plus the
+   * bucket array.
+   */
+  template <typename K, typename H, typename E, typename A>
+  static std::size_t heap_size (const std::unordered_set<K, H, E, A> & s)
+  {
+    return s.size() * (sizeof(K) + sizeof(void *)) +
+      s.bucket_count() * sizeof(void *);
+  }
+
+  template <typename K, typename T, typename H, typename E, typename A>
+  static std::size_t heap_size (const std::unordered_map<K, T, H, E, A> & m)
+  {
+    return m.size() * (sizeof(std::pair<const K, T>) + sizeof(void *)) +
+      m.bucket_count() * sizeof(void *);
+  }
+
+private:
+
+  /**
+   * The bytes per std::set or std::map node besides its value.
+   */
+  static const std::size_t tree_node_overhead = 4 * sizeof(void *);
+
+  std::map<std::string, std::size_t> _bytes;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_MEMORY_USAGE_H
@@ -0,0 +1,206 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_OBJECT_POOL_H
+#define LIBMESH_OBJECT_POOL_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+
+// C++ includes
+#include <algorithm> // std::max
+#include <cstddef>
+#include <functional> // std::less
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace libMesh
+{
+
+/**
+ * An \p ObjectPool constructs objects of type \p T in large chunks of
+ * contiguous memory rather than with a separate heap allocation for
+ * each object.  Objects built one after another lie next to each
+ * other in memory, which makes later traversals in construction
+ * order cache friendly, and freeing the whole pool only has to
+ * release a few chunks.
+ *
+ * Slots freed by destroy() are reused by later constructions once
+ * the current chunk is exhausted, before a new chunk is allocated.
+ * Chunk sizes double as the pool grows.
+ *
+ * \note Destroying the pool releases its memory but does not call
+ * the destructors of objects still alive in it.
+ *
+ * \brief Chunked storage for many objects of one type.
+ */
+template <typename T>
+class ObjectPool
+{
+public:
+
+  /**
+   * Constructor.  The first chunk will hold \p chunk_size objects.
+   */
+  explicit
+  ObjectPool (std::size_t chunk_size = 1024) :
+    _initial_chunk_size(chunk_size),
+    _next_chunk_size(chunk_size),
+    _next(nullptr),
+    _end(nullptr),
+    _n_objects(0)
+  { libmesh_assert(chunk_size); }
+
+  /**
+   * Pools own their chunks and can't be copied.
+   */
+  ObjectPool (const ObjectPool &) = delete;
+  ObjectPool & operator= (const ObjectPool &) = delete;
+
+  /**
+   * Constructs a new object in the pool from \p args.
+   */
+  template <typename... Args>
+  T * construct (Args &&... args)
+  {
+    Slot * slot;
+    if (_next != _end)
+      slot = _next++;
+    else if (!_free.empty())
+      {
+        slot = _free.back();
+        _free.pop_back();
+      }
+    else
+      {
+        this->add_chunk(_next_chunk_size);
+        slot = _next++;
+      }
+
+    T * obj = new (slot) T(std::forward<Args>(args)...);
+    ++_n_objects;
+    return obj;
+  }
+
+  /**
+   * Destroys \p obj, which must have been built by this pool, and
+   * makes its slot available for reuse.
+   */
+  void destroy (T * obj)
+  {
+    libmesh_assert(this->owns(obj));
+    libmesh_assert(_n_objects);
+
+    obj->~T();
+    _free.push_back(reinterpret_cast<Slot *>(obj));
+    --_n_objects;
+  }
+
+  /**
+   * \returns \p true if \p obj lies in memory owned by this pool.
+   */
+  bool owns (const T * obj) const
+  {
+    const Slot * slot = reinterpret_cast<const Slot *>(obj);
+    std::less<const Slot *> less;
+    for (const auto & range : _ranges)
+      if (!less(slot, range.first) && less(slot, range.second))
+        return true;
+    return false;
+  }
+
+  /**
+   * Makes sure that the next \p n objects constructed will be
+   * contiguous in memory.
+   */
+  void reserve (std::size_t n)
+  {
+    if (std::size_t(_end - _next) >= n)
+      return;
+
+    // Keep what's left of the current chunk for later reuse
+    for (; _next != _end; ++_next)
+      _free.push_back(_next);
+
+    this->add_chunk(n);
+  }
+
+  /**
+   * \returns The number of live objects in the pool.
+   */
+  std::size_t size () const { return _n_objects; }
+
+  /**
+   * Frees all the memory of the pool at once.  Every object in the
+   * pool must already have been destroyed.
+   */
+  void release_memory ()
+  {
+    libmesh_assert(!_n_objects);
+
+    _chunks.clear();
+    _ranges.clear();
+    _free.clear();
+    _next = _end = nullptr;
+    _next_chunk_size = _initial_chunk_size;
+  }
+
+private:
+
+  typedef typename std::aligned_storage<sizeof(T), alignof(T)>::type Slot;
+
+  void add_chunk (std::size_t n)
+  {
+    _chunks.emplace_back(new Slot[n]);
+    _next = _chunks.back().get();
+    _end = _next + n;
+    _ranges.emplace_back(_next, _end);
+
+    _next_chunk_size = std::max(_next_chunk_size, n) * 2;
+  }
+
+  const std::size_t _initial_chunk_size;
+
+  std::size_t _next_chunk_size;
+
+  /**
+   * The memory chunks, and the address range of each
+   */
+  std::vector<std::unique_ptr<Slot[]>> _chunks;
+  std::vector<std::pair<const Slot *, const Slot *>> _ranges;
+
+  /**
+   * The unused part of the newest chunk
+   */
+  Slot * _next, * _end;
+
+  /**
+   * Slots freed by destroy() or skipped by reserve()
+   */
+  std::vector<Slot *> _free;
+
+  std::size_t _n_objects;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_OBJECT_POOL_H
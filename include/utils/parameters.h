@@ -235,6 +235,46 @@ public:
     T _value;
   };
 
+  /**
+   * A typed handle to a parameter, which caches the result of
+   * looking it up.  Repeated reads through a handle cost an integer
+   * comparison rather than a string search and a dynamic_cast; the
+   * lookup is only redone after parameters have been removed or
+   * replaced.  The handle must not outlive its Parameters object.
+   */
+  template <typename T>
+  class Handle
+  {
+  public:
+    Handle () = default;
+
+    /**
+     * \returns A constant reference to the parameter value, as from
+     * Parameters::get().
+     */
+    const T & get () const;
+
+  private:
+    friend class Parameters;
+
+    Handle (const Parameters & params, const std::string & name) :
+      _params(&params), _name(name) {}
+
+    const Parameters * _params = nullptr;
+    std::string _name;
+
+    mutable const Parameter<T> * _param = nullptr;
+    mutable std::size_t _generation = 0;
+  };
+
+  /**
+   * \returns A handle for repeatedly reading the parameter named
+   * \p name.  The parameter need not exist until the handle is read.
+   */
+  template <typename T>
+  Handle<T> handle (const std::string & name) const
+  { return Handle<T>(*this, name); }
+
   /**
    * Parameter map iterator.
    */
@@ -272,6 +312,36 @@ protected:
    */
   std::map<std::string, Value *> _values;
 
+  /**
+   * Incremented whenever a Value in \p _values is deleted, to
+   * invalidate the lookups cached by handles.  Subclasses which
+   * delete values themselves must increment it too.
+   */
+  std::size_t _generation = 0;
+
+private:
+
+  /**
+   * \returns The parameter of type \p T named \p name, or nullptr if
+   * there is none.
+   */
+  template <typename T>
+  const Parameter<T> * find_parameter (const std::string & name) const;
+
+  /**
+   * \returns The parameter of type \p T named \p name, or throws an
+   * error listing the known parameters if there is none.
+   */
+  template <typename T>
+  const Parameter<T> & get_parameter (const std::string & name) const;
+
+  /**
+   * \returns The parameter of type \p T named \p name, creating it,
+   * and deleting any parameter of another type with that name, if
+   * necessary.
+   */
+  template <typename T>
+  Parameter<T> & emplace_parameter (const std::string & name);
 };
 
 // ------------------------------------------------------------
@@ -315,6 +385,9 @@ Parameters::Value * Parameters::Parameter<T>::clone () const
 inline
 void Parameters::clear () // since this is inline we must define it
 {                         // before its first use (for some compilers)
+  if (!_values.empty())
+    ++_generation;
+
   while (!_values.empty())
     {
       Parameters::iterator it = _values.begin();
@@ -342,9 +415,13 @@ Parameters & Parameters::operator+= (const Parameters & source)
 {
   for (const auto & pr : source._values)
     {
-      if (_values.find(pr.first) != _values.end())
-        delete _values[pr.first];
-      _values[pr.first] = pr.second->clone();
+      Value *& value = _values[pr.first];
+      if (value)
+        {
+          delete value;
+          ++_generation;
+        }
+      value = pr.second->clone();
     }
 
   return *this;
@@ -402,28 +479,40 @@ std::ostream & operator << (std::ostream & os, const Parameters & p)
 
 template <typename T>
 inline
-bool Parameters::have_parameter (const std::string & name) const
+const Parameters::Parameter<T> *
+Parameters::find_parameter (const std::string & name) const
 {
   Parameters::const_iterator it = _values.find(name);
 
-  if (it != _values.end())
+  if (it == _values.end())
+    return nullptr;
+
 #ifdef LIBMESH_HAVE_RTTI
-    if (dynamic_cast<const Parameter<T> *>(it->second) != nullptr)
+  return dynamic_cast<const Parameter<T> *>(it->second);
 #else // LIBMESH_HAVE_RTTI
-      if (cast_ptr<const Parameter<T> *>(it->second) != nullptr)
+  return cast_ptr<const Parameter<T> *>(it->second);
 #endif // LIBMESH_HAVE_RTTI
-        return true;
+}
+
 
-  return false;
+
+template <typename T>
+inline
+bool Parameters::have_parameter (const std::string & name) const
+{
+  return this->find_parameter<T>(name) != nullptr;
 }
 
 
 
 template <typename T>
 inline
-const T & Parameters::get (const std::string & name) const
+const Parameters::Parameter<T> &
+Parameters::get_parameter (const std::string & name) const
 {
-  if (!this->have_parameter<T>(name))
+  const Parameter<T> * param = this->find_parameter<T>(name);
+
+  if (!param)
     {
       std::ostringstream oss;
 
@@ -439,20 +528,71 @@ const T & Parameters::get (const std::string & name) const
       libmesh_error_msg(oss.str());
     }
 
-  Parameters::const_iterator it = _values.find(name);
+  return *param;
+}
+
 
-  libmesh_assert(it != _values.end());
-  libmesh_assert(it->second);
 
-  return cast_ptr<Parameter<T> *>(it->second)->get();
+template <typename T>
+inline
+const T & Parameters::get (const std::string & name) const
+{
+  return this->get_parameter<T>(name).get();
 }
 
+
+
+template <typename T>
+inline
+Parameters::Parameter<T> &
+Parameters::emplace_parameter (const std::string & name)
+{
+  Value *& value = _values[name];
+
+  if (value)
+    {
+#ifdef LIBMESH_HAVE_RTTI
+      Parameter<T> * param = dynamic_cast<Parameter<T> *>(value);
+#else // LIBMESH_HAVE_RTTI
+      Parameter<T> * param = cast_ptr<Parameter<T> *>(value);
+#endif // LIBMESH_HAVE_RTTI
+      if (param)
+        return *param;
+
+      // Replace the parameter of another type with this name
+      delete value;
+      ++_generation;
+    }
+
+  Parameter<T> * param = new Parameter<T>;
+  value = param;
+  return *param;
+}
+
+
+
+template <typename T>
+inline
+const T & Parameters::Handle<T>::get () const
+{
+  libmesh_assert(_params);
+
+  if (!_param || _generation != _params->_generation)
+    {
+      _param = &_params->get_parameter<T>(_name);
+      _generation = _params->_generation;
+    }
+
+  return _param->get();
+}
+
+
+
 template <typename T>
 inline
 void Parameters::insert (const std::string & name)
 {
-  if (!this->have_parameter<T>(name))
-    _values[name] = new Parameter<T>;
+  this->emplace_parameter<T>(name);
 
   set_attributes(name, true);
 }
@@ -462,12 +602,11 @@ template <typename T>
 inline
 T & Parameters::set (const std::string & name)
 {
-  if (!this->have_parameter<T>(name))
-    _values[name] = new Parameter<T>;
+  Parameter<T> & param = this->emplace_parameter<T>(name);
 
   set_attributes(name, false);
 
-  return cast_ptr<Parameter<T> *>(_values[name])->set();
+  return param.set();
 }
 
 inline
@@ -481,6 +620,8 @@ void Parameters::remove (const std::string & name)
       it->second = nullptr;
 
       _values.erase(it);
+
+      ++_generation;
     }
 }
 
@@ -25,8 +25,12 @@
 #include "libmesh/libmesh_common.h"
 
 // C++ includes
+#include <chrono>
 #include <cstddef>
+#include <cstdint>
+#include <iosfwd>
 #include <map>
+#include <memory>
 #include <stack>
 #include <string>
 #include <vector>
@@ -35,6 +39,11 @@
 namespace libMesh
 {
 
+// Forward declarations
+namespace Parallel {
+  class Communicator;
+}
+
 /**
  * The \p PerfData class simply contains the performance
  * data that is recorded for individual events.
@@ -57,7 +66,8 @@ public:
     tstart_incl_sub(),
     count(0),
     open(false),
-    called_recursively(0)
+    called_recursively(0),
+    counts()
   {}
 
 
@@ -104,6 +114,21 @@ public:
 
   int called_recursively;
 
+  /**
+   * The hardware counters PerfLog::enable_counters() can record.
+   */
+  enum Counter { CYCLES = 0,
+                 INSTRUCTIONS,
+                 CACHE_REFERENCES,
+                 CACHE_MISSES,
+                 N_COUNTERS };
+
+  /**
+   * Hardware counts during this event, excluding sub-events, if
+   * counters are enabled.
+   */
+  std::uint64_t counts[N_COUNTERS];
+
 protected:
   double stop_or_pause(const bool do_stop);
 };
@@ -287,6 +312,92 @@ public:
    */
   PerfData get_perf_data(const std::string & label, const std::string & header="");
 
+  /**
+   * Starts or stops recording a timeline of events alongside the
+   * summary log.  While tracing, every push and pop is also recorded,
+   * with its start and end time, in a buffer belonging to the calling
+   * thread; this is safe inside Threads::parallel_for(), where the
+   * summary log itself is disabled.
+   *
+   * Tracing should only be toggled outside of threaded regions.
+   */
+  void enable_tracing(bool enable = true);
+
+  /**
+   * \returns \p true iff a timeline is being recorded.
+   */
+  bool tracing_enabled() const { return trace_events; }
+
+  /**
+   * Sets the maximum number of events recorded per thread; later
+   * events are counted but dropped.  Defaults to 2^20.
+   */
+  void set_trace_capacity(std::size_t capacity) { trace_capacity = capacity; }
+
+  /**
+   * Writes the recorded timeline in the Chrome trace event JSON
+   * format, which chrome://tracing and Perfetto can display, with
+   * process id \p pid.
+   */
+  void write_chrome_trace(std::ostream & os,
+                          processor_id_type pid = 0) const;
+
+  /**
+   * Gathers the recorded timelines of every processor in \p comm and
+   * writes them to \p filename on processor 0, one trace process per
+   * rank.  Each rank's times are relative to when it enabled tracing.
+   */
+  void write_chrome_trace(const std::string & filename,
+                          const Parallel::Communicator & comm) const;
+
+  /**
+   * Writes the recorded timeline as CSV, one line per event:
+   * rank,thread,header,label,begin,end with times in seconds.
+   */
+  void write_trace_csv(std::ostream & os,
+                       processor_id_type pid = 0,
+                       bool print_header = true) const;
+
+  /**
+   * Gathers the recorded timelines of every processor in \p comm and
+   * writes them as CSV to \p filename on processor 0.
+   */
+  void write_trace_csv(const std::string & filename,
+                       const Parallel::Communicator & comm) const;
+
+  /**
+   * Starts reading hardware counters (see PerfData::Counter) at each
+   * push and pop, to report them per event alongside times.  This
+   * uses Linux perf events, and counts only the calling thread, which
+   * should be the thread that logs events.
+   *
+   * \returns \p true iff the counters could be opened; this may fail
+   * on other platforms, or under a restrictive perf_event_paranoid
+   * setting.
+   */
+  bool enable_counters();
+
+  /**
+   * Stops reading hardware counters.
+   */
+  void disable_counters();
+
+  /**
+   * \returns \p true iff hardware counters are being read.
+   */
+  bool counters_enabled() const { return count_events; }
+
+  /**
+   * \returns A string containing the hardware counts per event, if
+   * any were recorded.
+   */
+  std::string get_counter_info() const;
+
+  /**
+   * Per-thread storage for the timeline, defined in perf_log.C.
+   */
+  struct TraceBuffer;
+
   /**
    * Typdef for the underlying logging data structure.
    */
@@ -294,6 +405,11 @@ public:
                              const char *>,
                    PerfData> log_type;
 
+  /**
+   * \returns The raw log data, e.g. for writing it in another format.
+   */
+  const log_type & get_log_raw() const { return log; }
+
 private:
 
 
@@ -354,6 +470,73 @@ private:
    * doc, so let's be safe.
    */
   std::map<std::string, const char *> non_temporary_strings;
+
+  /**
+   * Adds the hardware counts since the last sample to the event on
+   * top of the stack.
+   */
+  void sample_counters();
+
+  /**
+   * Flag to read hardware counters at each push and pop.
+   */
+  bool count_events;
+
+  /**
+   * The perf event file descriptors for each counter; the first
+   * leads the group.
+   */
+  int counter_fds[PerfData::N_COUNTERS];
+
+  /**
+   * The counts at the last sample.
+   */
+  std::uint64_t last_counts[PerfData::N_COUNTERS];
+
+  /**
+   * Records the start and end of an event in the calling thread's
+   * timeline.
+   */
+  void trace_push (const char * label, const char * header);
+  void trace_pop ();
+
+  /**
+   * \returns The calling thread's timeline buffer, creating it if
+   * necessary.
+   */
+  TraceBuffer & trace_buffer ();
+
+  /**
+   * Writes the completed events of every thread as comma-separated
+   * Chrome trace event objects, preceded by a process name.
+   */
+  void write_chrome_trace_events (std::ostream & os,
+                                  processor_id_type pid) const;
+
+  /**
+   * Flag to record a timeline of all events.
+   */
+  bool trace_events;
+
+  /**
+   * The maximum number of events recorded per thread.
+   */
+  std::size_t trace_capacity;
+
+  /**
+   * Identifies this object to the per-thread buffer lookup cache.
+   */
+  const unsigned int trace_id;
+
+  /**
+   * The time tracing was enabled or last cleared.
+   */
+  std::chrono::steady_clock::time_point trace_start;
+
+  /**
+   * One timeline buffer per thread which has logged an event.
+   */
+  std::vector<std::unique_ptr<TraceBuffer>> trace_buffers;
 };
 
 
@@ -451,12 +634,18 @@ inline
 void PerfLog::fast_push (const char * label,
                          const char * header)
 {
+  if (this->trace_events)
+    this->trace_push(label, header);
+
   if (this->log_events)
     {
       // Get a reference to the event data to avoid
       // repeated map lookups
       PerfData * perf_data = &(log[std::make_pair(header,label)]);
 
+      if (this->count_events)
+        this->sample_counters();
+
       if (!log_stack.empty())
         total_time += log_stack.top()->pause_for(*perf_data);
       else
@@ -471,6 +660,9 @@ inline
 void PerfLog::fast_pop(const char * libmesh_dbg_var(label),
                        const char * libmesh_dbg_var(header))
 {
+  if (this->trace_events)
+    this->trace_pop();
+
   if (this->log_events)
     {
       libmesh_assert (!log_stack.empty());
@@ -489,6 +681,9 @@ void PerfLog::fast_pop(const char * libmesh_dbg_var(label),
         }
 #endif
 
+      if (this->count_events)
+        this->sample_counters();
+
       total_time += log_stack.top()->stopit();
 
       log_stack.pop();
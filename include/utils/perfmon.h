@@ -44,6 +44,8 @@ namespace libMesh
  * PAPI stands for Performance Application Programming Interface.
  * This class was supposed to provide an interface to the hardware
  * timers that PAPI exposes, but it never really got developed.
+ * For hardware counts per logged event, see
+ * PerfLog::enable_counters() instead.
  *
  * \author Benjamin S. Kirk
  * \date 2002
@@ -134,6 +134,105 @@ public:
                const std::set<subdomain_id_type> * allowed_subdomains = nullptr,
                Real tol = TOLERANCE) const;
 
+  /**
+   * Locates the element containing each of \p points, storing the
+   * results in \p elems, which is resized to match.  Points which are
+   * found in no element get a \p nullptr entry, in out-of-mesh mode.
+   *
+   * The points are visited in Morton order, and each lookup first
+   * walks from the element found for the previous point, as
+   * \p locate_from_hint() does, before falling back on the full
+   * search, so coherent batches of points avoid most tree
+   * traversals.  The
+   * lookups are split across threads and do not use or modify the
+   * single-point cache, so results do not depend on the order of
+   * \p points.
+   *
+   * Optionally allows the user to restrict the subdomains searched.
+   */
+  void locate_points (const std::vector<Point> & points,
+                      std::vector<const Elem *> & elems,
+                      const std::set<subdomain_id_type> * allowed_subdomains = nullptr) const;
+
+  /**
+   * Locates the element in which the point with global coordinates
+   * \p p is located, starting from the element \p hint, which is
+   * typically the element found for a nearby earlier point.  If
+   * \p hint does not contain \p p, we walk from it through neighbor
+   * links toward \p p, and only fall back on the full search if no
+   * element along the walk contains \p p.  \p hint may be
+   * \p nullptr.
+   *
+   * Unlike \p operator(), this does not use or modify the cached
+   * last element, so it may be called concurrently from multiple
+   * threads.  Optionally allows the user to restrict the subdomains
+   * searched.
+   */
+  const Elem * locate_from_hint (const Point & p,
+                                 const Elem * hint,
+                                 const std::set<subdomain_id_type> * allowed_subdomains = nullptr) const;
+
+  /**
+   * Counts of how lookups which started from a hint element,
+   * including those made by \p locate_points(), were resolved.
+   * Lookups which were not resolved by the walk fell back on the
+   * full search.
+   */
+  struct HintStatistics
+  {
+    HintStatistics () :
+      n_queries(0), n_hint_hits(0), n_walk_hits(0), n_walk_steps(0) {}
+
+    /**
+     * The number of lookups given a hint element
+     */
+    std::size_t n_queries;
+
+    /**
+     * The number of points found in the hint element itself
+     */
+    std::size_t n_hint_hits;
+
+    /**
+     * The number of points found by walking away from the hint
+     */
+    std::size_t n_walk_hits;
+
+    /**
+     * The total number of neighbor steps taken by all walks
+     */
+    std::size_t n_walk_steps;
+
+    /**
+     * \returns The number of lookups which needed the full search
+     */
+    std::size_t n_fallbacks () const
+    { return n_queries - n_hint_hits - n_walk_hits; }
+  };
+
+  /**
+   * \returns Statistics on hinted lookups since construction or the
+   * last \p reset_hint_statistics().
+   */
+  HintStatistics get_hint_statistics () const;
+
+  /**
+   * Zeroes the statistics on hinted lookups.
+   */
+  void reset_hint_statistics ();
+
+  /**
+   * Set the largest number of neighbor steps taken from a hint
+   * element before falling back on the full search.
+   */
+  void set_max_walk_steps (unsigned int max_walk_steps);
+
+  /**
+   * Get the largest number of neighbor steps taken from a hint
+   * element before falling back on the full search.
+   */
+  unsigned int get_max_walk_steps () const;
+
   /**
    * \returns \p true when this object is properly initialized
    * and ready for use, \p false otherwise.
@@ -201,6 +300,49 @@ public:
   bool _verbose;
 
 protected:
+  /**
+   * Locates the element in which the point with global coordinates
+   * \p p is located, without using any cached element.  This is
+   * called concurrently by \p locate_points() and must be thread
+   * safe.  \returns \p nullptr if no element is found, which is
+   * only allowed in out-of-mesh mode.
+   */
+  virtual const Elem * find_element (const Point & p,
+                                     const std::set<subdomain_id_type> * allowed_subdomains) const = 0;
+
+  /**
+   * \returns \p true if \p elem is one this locator may return:
+   * by default, any active element.  Subclasses which only search
+   * part of the mesh should narrow this, since \p locate_points()
+   * may find elements by walking through neighbor links.
+   */
+  virtual bool can_locate (const Elem & elem) const;
+
+  /**
+   * \returns \p true if \p elem is allowed by \p allowed_subdomains
+   * and contains \p p to within the contains-point tolerance.
+   */
+  bool element_contains (const Elem & elem,
+                         const Point & p,
+                         const std::set<subdomain_id_type> * allowed_subdomains) const;
+
+  /**
+   * Walks from \p hint through neighbor links, at each step moving
+   * to the neighbor whose centroid is closest to \p p, until an
+   * element containing \p p is found or \p _max_walk_steps steps
+   * have been taken.  \returns The element found, or \p nullptr, and
+   * the number of steps taken in \p n_steps.
+   */
+  const Elem * walk_from (const Elem * hint,
+                          const Point & p,
+                          const std::set<subdomain_id_type> * allowed_subdomains,
+                          unsigned int & n_steps) const;
+
+  /**
+   * Adds \p stats to the statistics on hinted lookups.  Thread safe.
+   */
+  void add_hint_statistics (const HintStatistics & stats) const;
+
   /**
    * Const pointer to our master, initialized to \p nullptr if none
    * given.  When using multiple PointLocators, one can be assigned
@@ -239,6 +381,23 @@ protected:
    * The tolerance to use when locating an element in the tree.
    */
   Real _contains_point_tol;
+
+  /**
+   * The largest number of steps a walk from a hint element may take.
+   */
+  unsigned int _max_walk_steps;
+
+  /**
+   * Statistics on hinted lookups.
+   */
+  mutable HintStatistics _hint_statistics;
+
+private:
+  /**
+   * Functor used by \p locate_points() to search its threaded
+   * sub-ranges.
+   */
+  class LocatePoints;
 };
 
 } // namespace libMesh
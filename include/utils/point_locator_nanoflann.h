@@ -0,0 +1,246 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+#ifndef LIBMESH_POINT_LOCATOR_NANOFLANN_H
+#define LIBMESH_POINT_LOCATOR_NANOFLANN_H
+
+#include "libmesh/libmesh_config.h"
+
+#ifdef LIBMESH_HAVE_NANOFLANN
+
+// Local Includes
+#include "libmesh/point_locator_base.h"
+#include "libmesh/point.h"
+#include "libmesh/ignore_warnings.h"
+#include "libmesh/nanoflann.hpp"
+#include "libmesh/restore_warnings.h"
+
+// C++ includes
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace libMesh
+{
+
+// Forward Declarations
+class MeshBase;
+class Elem;
+
+/**
+ * This is a point locator which uses a nanoflann KD-tree of the
+ * centroids of the active elements in a mesh.  A point is located by
+ * testing the elements with the nearest centroids, widening the
+ * search until every element whose bounding sphere could contain the
+ * point has been tested.  Unlike \p PointLocatorTree, lookups do not
+ * degrade into long linear scans of large bins on strongly graded
+ * meshes.
+ *
+ * Use \p PointLocatorBase::build() with \p NANOFLANN to create
+ * objects of this type at run time, or select it for
+ * \p MeshBase::sub_point_locator() with
+ * \p MeshBase::set_point_locator_type().
+ *
+ * \brief KD-tree based PointLocator.
+ */
+class PointLocatorNanoflann : public PointLocatorBase
+{
+public:
+  /**
+   * Constructor.  Needs the \p mesh in which the points should be
+   * located.  Optionally takes a master locator, in which case the
+   * master's KD-tree is shared rather than built again.
+   */
+  PointLocatorNanoflann (const MeshBase & mesh,
+                         const PointLocatorBase * master = nullptr);
+
+  /**
+   * Destructor.
+   */
+  ~PointLocatorNanoflann ();
+
+  /**
+   * Clears the locator.
+   */
+  virtual void clear() override;
+
+  /**
+   * Initializes the locator, so that the \p operator() methods can
+   * be used.  The element centroids and bounding radii are computed
+   * in parallel, if threads are available.
+   */
+  virtual void init() override;
+
+  /**
+   * Locates the element in which the point with global coordinates
+   * \p p is located, optionally restricted to a set of allowed
+   * subdomains.  The last element found is cached and tested first
+   * on the next call.
+   */
+  virtual const Elem * operator() (const Point & p,
+                                   const std::set<subdomain_id_type> * allowed_subdomains = nullptr) const override;
+
+  /**
+   * Locates the set of elements which are within the close-to-point
+   * tolerance of \p p, optionally restricted to a set of allowed
+   * subdomains.
+   */
+  virtual void operator() (const Point & p,
+                           std::set<const Elem *> & candidate_elements,
+                           const std::set<subdomain_id_type> * allowed_subdomains = nullptr) const override;
+
+  /**
+   * Enables out-of-mesh mode.  In this mode, if asked to find a point
+   * that is contained in no mesh at all, the point locator will
+   * return nullptr instead of crashing.  Per default, this
+   * mode is off.
+   */
+  virtual void enable_out_of_mesh_mode () override;
+
+  /**
+   * Disables out-of-mesh mode (default).  If asked to find a point
+   * that is contained in no mesh at all, the point locator will now
+   * crash.
+   */
+  virtual void disable_out_of_mesh_mode () override;
+
+  /**
+   * Set the number of nearest element centroids fetched from the
+   * KD-tree by the first search for each point.  Later searches for
+   * the same point fetch twice as many as the one before.
+   */
+  void set_num_results (unsigned int num_results);
+
+  /**
+   * Get the number of nearest element centroids fetched by the first
+   * search for each point.
+   */
+  unsigned int get_num_results () const;
+
+  /**
+   * This class adapts the element centroids for use in a nanoflann
+   * KD-tree.
+   */
+  class CentroidAdaptor
+  {
+  public:
+    CentroidAdaptor (const std::vector<Point> & centroids) :
+      _centroids(centroids)
+    {}
+
+    /**
+     * libMesh \p Point coordinate type
+     */
+    typedef Real coord_t;
+
+    /**
+     * \returns The number of data points
+     */
+    std::size_t kdtree_get_point_count() const { return _centroids.size(); }
+
+    /**
+     * \returns The dim'th component of the idx'th centroid
+     */
+    coord_t kdtree_get_pt(const std::size_t idx, int dim) const
+    {
+      libmesh_assert_less (idx, _centroids.size());
+      libmesh_assert_less (dim, LIBMESH_DIM);
+      return _centroids[idx](dim);
+    }
+
+    /**
+     * Use the standard bounding box computation.
+     */
+    template <class BBOX>
+    bool kdtree_get_bbox(BBOX & /* bb */) const { return false; }
+
+  private:
+    const std::vector<Point> & _centroids;
+  };
+
+  typedef nanoflann::KDTreeSingleIndexAdaptor<nanoflann::L2_Simple_Adaptor<Real, CentroidAdaptor>,
+                                              CentroidAdaptor, LIBMESH_DIM> kd_tree_t;
+
+protected:
+  /**
+   * Everything built by \p init(), shared by a master and its
+   * servants.
+   */
+  struct KDTreeData
+  {
+    KDTreeData () : adaptor(centroids), max_radius(0) {}
+
+    /**
+     * The active elements in the tree, and their centroids
+     */
+    std::vector<const Elem *> elems;
+    std::vector<Point> centroids;
+
+    /**
+     * The distance from each element's centroid to its farthest node,
+     * and the largest such distance.
+     */
+    std::vector<Real> radii;
+    CentroidAdaptor adaptor;
+    Real max_radius;
+
+    std::unique_ptr<kd_tree_t> tree;
+  };
+
+  /**
+   * Finds an element containing \p p, or within the close-to-point
+   * tolerance of \p p if \p use_close_to_point is \p true, without
+   * using or updating the cached element.
+   */
+  const Elem * search (const Point & p,
+                       const std::set<subdomain_id_type> * allowed_subdomains,
+                       bool use_close_to_point) const;
+
+  /**
+   * Finds an element for \p p, trying the close-to-point tolerance
+   * if no element contains it and that tolerance has been set.
+   */
+  virtual const Elem * find_element (const Point & p,
+                                     const std::set<subdomain_id_type> * allowed_subdomains) const override;
+
+  /**
+   * The KD-tree, built by the master locator at \p init().
+   */
+  std::shared_ptr<const KDTreeData> _data;
+
+  /**
+   * Pointer to the last element that was found.
+   */
+  mutable const Elem * _element;
+
+  /**
+   * \p true if out-of-mesh mode is enabled.
+   */
+  bool _out_of_mesh_mode;
+
+  /**
+   * The number of centroids fetched by the first search for a point.
+   */
+  unsigned int _num_results;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_HAVE_NANOFLANN
+
+#endif // LIBMESH_POINT_LOCATOR_NANOFLANN_H
@@ -163,6 +163,20 @@ public:
   unsigned int get_target_bin_size() const;
 
 protected:
+  /**
+   * Asks the tree for the element containing \p p, falling back on
+   * a linear search when a close-to-point tolerance is set.  Does
+   * not use the cached \p _element.
+   */
+  virtual const Elem * find_element (const Point & p,
+                                     const std::set<subdomain_id_type> * allowed_subdomains) const override;
+
+  /**
+   * \returns \p true if \p elem is active and, for a tree built from
+   * local elements only, local.
+   */
+  virtual bool can_locate (const Elem & elem) const override;
+
   /**
    * Pointer to our tree.  The tree is built at run-time
    * through \p init().  For servant PointLocators (not master),
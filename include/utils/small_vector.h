@@ -0,0 +1,296 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+
+#ifndef LIBMESH_SMALL_VECTOR_H
+#define LIBMESH_SMALL_VECTOR_H
+
+// libMesh includes
+#include "libmesh/libmesh_common.h"
+
+// C++ Includes
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+namespace libMesh
+{
+
+/**
+ * This \p SmallVector templated class is a contiguous sequence
+ * container with a subset of the std::vector interface, which stores
+ * up to \p N values inline and only falls back on the heap for
+ * longer sequences.  This avoids a separate heap allocation (and the
+ * allocator overhead that comes with it) for the many small
+ * sequences that occur in e.g. per-node index data.
+ *
+ * Iterators are plain pointers, and are invalidated by any operation
+ * which changes the size of the sequence.
+ *
+ * \note Only trivially copyable types are supported.
+ *
+ * \brief A vector with inline storage for short sequences.
+ */
+template <typename T, unsigned int N>
+class SmallVector
+{
+  static_assert(std::is_trivially_copyable<T>::value,
+                "SmallVector only supports trivially copyable types");
+
+public:
+
+  typedef T                value_type;
+  typedef T &              reference;
+  typedef const T &        const_reference;
+  typedef T *              iterator;
+  typedef const T *        const_iterator;
+  typedef std::size_t      size_type;
+  typedef std::ptrdiff_t   difference_type;
+
+  SmallVector () :
+    _data(_buffer), _size(0), _capacity(N)
+  {}
+
+  explicit
+  SmallVector (size_type n, const T & val = T()) :
+    SmallVector()
+  { this->resize(n, val); }
+
+  /**
+   * Copies only allocate as much heap storage as they need, so
+   * the usual swap trick can be used to shrink a vector to fit.
+   */
+  SmallVector (const SmallVector & other) :
+    SmallVector()
+  { this->assign(other.begin(), other.end()); }
+
+  SmallVector (SmallVector && other) :
+    SmallVector()
+  { this->take(other); }
+
+  ~SmallVector ()
+  { this->free_heap(); }
+
+  SmallVector & operator= (const SmallVector & other)
+  {
+    if (this != &other)
+      this->assign(other.begin(), other.end());
+    return *this;
+  }
+
+  SmallVector & operator= (SmallVector && other)
+  {
+    if (this != &other)
+      {
+        this->free_heap();
+        this->take(other);
+      }
+    return *this;
+  }
+
+  /**
+   * Replaces the contents with the values in [first, last), which
+   * must not lie in this vector.
+   */
+  template <typename ForwardIter>
+  void assign (ForwardIter first, ForwardIter last)
+  {
+    const size_type n = std::distance(first, last);
+    if (n > _capacity)
+      {
+        this->free_heap();
+        _data = new T[n];
+        _capacity = cast_int<unsigned int>(n);
+      }
+    std::copy(first, last, _data);
+    _size = cast_int<unsigned int>(n);
+  }
+
+  size_type size () const { return _size; }
+  size_type capacity () const { return _capacity; }
+  bool empty () const { return !_size; }
+
+  T & operator[] (size_type i)
+  { libmesh_assert_less (i, _size); return _data[i]; }
+
+  const T & operator[] (size_type i) const
+  { libmesh_assert_less (i, _size); return _data[i]; }
+
+  T & back () { libmesh_assert(_size); return _data[_size-1]; }
+  const T & back () const { libmesh_assert(_size); return _data[_size-1]; }
+
+  T * data () { return _data; }
+  const T * data () const { return _data; }
+
+  iterator begin () { return _data; }
+  iterator end () { return _data + _size; }
+  const_iterator begin () const { return _data; }
+  const_iterator end () const { return _data + _size; }
+
+  void reserve (size_type n)
+  {
+    if (n > _capacity)
+      this->reallocate(n);
+  }
+
+  void resize (size_type n, const T & val = T())
+  {
+    if (n > _size)
+      {
+        const T copy = val;
+        this->reserve(n);
+        std::fill(_data + _size, _data + n, copy);
+      }
+    _size = cast_int<unsigned int>(n);
+  }
+
+  /**
+   * Empties the vector, keeping any heap storage for reuse.
+   */
+  void clear () { _size = 0; }
+
+  void push_back (const T & val)
+  {
+    const T copy = val;
+    if (_size == _capacity)
+      this->reallocate(2*_capacity);
+    _data[_size++] = copy;
+  }
+
+  iterator insert (const_iterator pos, const T & val)
+  {
+    // val may refer into our own storage
+    const T copy = val;
+    const size_type i = pos - _data;
+    libmesh_assert_less_equal (i, _size);
+    if (_size == _capacity)
+      this->reallocate(2*_capacity);
+    std::copy_backward(_data + i, _data + _size, _data + _size + 1);
+    _data[i] = copy;
+    ++_size;
+    return _data + i;
+  }
+
+  /**
+   * Inserts the values in [first, last), which must not lie in this
+   * vector, before \p pos.
+   */
+  template <typename ForwardIter>
+  iterator insert (const_iterator pos, ForwardIter first, ForwardIter last)
+  {
+    const size_type i = pos - _data;
+    const size_type n = std::distance(first, last);
+    libmesh_assert_less_equal (i, _size);
+    if (_size + n > _capacity)
+      this->reallocate(std::max(size_type(2*_capacity), _size + n));
+    std::copy_backward(_data + i, _data + _size, _data + _size + n);
+    std::copy(first, last, _data + i);
+    _size += cast_int<unsigned int>(n);
+    return _data + i;
+  }
+
+  iterator erase (const_iterator first, const_iterator last)
+  {
+    const size_type i = first - _data;
+    const size_type n = last - first;
+    libmesh_assert_less_equal (i + n, _size);
+    std::copy(_data + i + n, _data + _size, _data + i);
+    _size -= cast_int<unsigned int>(n);
+    return _data + i;
+  }
+
+  iterator erase (const_iterator pos)
+  { return this->erase(pos, pos+1); }
+
+  void swap (SmallVector & other)
+  {
+    if (this->on_heap() && other.on_heap())
+      {
+        std::swap(_data, other._data);
+        std::swap(_size, other._size);
+        std::swap(_capacity, other._capacity);
+      }
+    else
+      {
+        SmallVector tmp(std::move(other));
+        other = std::move(*this);
+        *this = std::move(tmp);
+      }
+  }
+
+private:
+
+  bool on_heap () const { return _data != _buffer; }
+
+  void free_heap ()
+  {
+    if (this->on_heap())
+      delete [] _data;
+    _data = _buffer;
+    _capacity = N;
+  }
+
+  /**
+   * Moves the contents of \p other, which is left empty, into this
+   * vector, which must not own heap storage.
+   */
+  void take (SmallVector & other)
+  {
+    libmesh_assert(!this->on_heap());
+
+    if (other.on_heap())
+      {
+        _data = other._data;
+        _capacity = other._capacity;
+        other._data = other._buffer;
+        other._capacity = N;
+      }
+    else
+      std::copy(other.begin(), other.end(), _buffer);
+
+    _size = other._size;
+    other._size = 0;
+  }
+
+  void reallocate (size_type n)
+  {
+    libmesh_assert_greater_equal (n, _size);
+
+    // N may be zero
+    n = std::max(n, size_type(1));
+
+    T * new_data = new T[n];
+    std::copy(_data, _data + _size, new_data);
+    if (this->on_heap())
+      delete [] _data;
+    _data = new_data;
+    _capacity = cast_int<unsigned int>(n);
+  }
+
+  T * _data;
+
+  unsigned int _size, _capacity;
+
+  T _buffer[N ? N : 1];
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_SMALL_VECTOR_H
@@ -23,9 +23,9 @@
 // Local Includes
 #include "libmesh/libmesh_config.h"
 #include "libmesh/libmesh_common.h"
+#include "libmesh/concurrent_hash_map.h"
 
 // C++ Includes
-#include <unordered_map>
 #include <functional> // std::hash
 #include <vector>
 
@@ -59,8 +59,9 @@ public:
  * A node created in the middle of a cell's quad face will be the
  * value of two keys, one for each node pair bracketing it.
  *
- * For efficiency we will use a hashed map if it is available,
- * otherwise a regular map.
+ * The map is a ConcurrentHashMap, so once it has been pre-sized with
+ * reserve(), add_node() and find() may be called concurrently from
+ * the bodies of a Threads::parallel_for().
  *
  * \author Roy Stogner
  * \date 2015
@@ -69,12 +70,18 @@ public:
 class TopologyMap
 {
   // We need to supply our own hash function.
-  typedef std::unordered_map<std::pair<dof_id_type, dof_id_type>, dof_id_type, myhash> map_type;
+  typedef ConcurrentHashMap<std::pair<dof_id_type, dof_id_type>, dof_id_type, myhash> map_type;
 public:
   void init(MeshBase &);
 
   void clear() { _map.clear(); }
 
+  /**
+   * Pre-sizes the map for \p n bracketing node pairs in total, as is
+   * required before adding nodes from multiple threads.
+   */
+  void reserve(std::size_t n) { _map.reserve(n); }
+
   /**
    * Add a node to the map, between each pair of specified bracketing
    * nodes.
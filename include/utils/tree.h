@@ -21,6 +21,7 @@
 #define LIBMESH_TREE_H
 
 // Local includes
+#include "libmesh/elem_containment_cache.h"
 #include "libmesh/tree_node.h"
 #include "libmesh/tree_base.h"
 
@@ -116,6 +117,12 @@ private:
    * How the tree is built.
    */
   const Trees::BuildType build_type;
+
+  /**
+   * Bounding boxes and inverse maps of the elements in the tree, for
+   * quickly testing whether they contain points.
+   */
+  ElemContainmentCache containment_cache;
 };
 
 
@@ -38,6 +38,7 @@ namespace libMesh
 class MeshBase;
 class Node;
 class Elem;
+class ElemContainmentCache;
 
 /**
  * This class defines a node on a tree.  A tree node
@@ -106,6 +107,14 @@ public:
    */
   void set_bounding_box (const std::pair<Point, Point> & bbox);
 
+  /**
+   * Sets the cache used, by this node and any children refined from
+   * it later, to test whether elements contain points.  If it is
+   * null, as by default, the elements are asked directly.
+   */
+  void set_containment_cache (const ElemContainmentCache * cache)
+  { containment_cache = cache; }
+
   /**
    * \returns \p true if this TreeNode (or its children) contain node n
    * (within relative tolerance), false otherwise.
@@ -245,6 +254,19 @@ private:
    * Does this node contain any infinite elements.
    */
   bool contains_ifems;
+
+  /**
+   * Saved element data for containment tests, or nullptr
+   */
+  const ElemContainmentCache * containment_cache;
+
+  /**
+   * \returns \p true if \p elem contains \p p, using the
+   * containment cache if we have one.
+   */
+  bool elem_contains_point (const Elem & elem,
+                            const Point & p,
+                            Real relative_tol) const;
 };
 
 
@@ -262,7 +284,8 @@ TreeNode<N>::TreeNode (const MeshBase & m,
   parent         (p),
   tgt_bin_size   (tbs),
   target_bin_size_increase_level(10),
-  contains_ifems (false)
+  contains_ifems (false),
+  containment_cache (p ? p->containment_cache : nullptr)
 {
   // libmesh_assert our children are empty, thus we are active.
   libmesh_assert (children.empty());
@@ -427,8 +427,8 @@ int mkdir(const char* pathname);
 
 
 /**
- * Create an unzipped copy of a bz2 or xz file, returning the name of
- * the now-unzipped file that can be directly opened.
+ * Create an unzipped copy of a bz2, xz or zb file, returning the name
+ * of the now-unzipped file that can be directly opened.
  *
  * This is a hack because we don't have a neat bz2/xz equivalent to
  * gzstreams.
@@ -436,6 +436,36 @@ int mkdir(const char* pathname);
 std::string unzip_file (const std::string & name);
 
 
+/**
+ * Compress \p unzipped_name into a ".zb" file \p zipped_name, a
+ * series of independently deflated blocks of \p block_size bytes
+ * followed by an index of their compressed sizes.  Batches of blocks
+ * are compressed in parallel on libMesh::n_threads() threads.
+ *
+ * Requires zlib, which libMesh uses when configured with gzstreams.
+ */
+void block_zip_file (const std::string & unzipped_name,
+                     const std::string & zipped_name,
+                     const std::size_t block_size = 1 << 20);
+
+/**
+ * Decompress the ".zb" file \p zipped_name, written by
+ * block_zip_file(), into \p unzipped_name, decompressing blocks in
+ * parallel.
+ */
+void block_unzip_file (const std::string & zipped_name,
+                       const std::string & unzipped_name);
+
+/**
+ * \returns Bytes [begin, end) of the uncompressed contents of the
+ * ".zb" file \p zipped_name.  Only the blocks overlapping that range
+ * are read and decompressed.
+ */
+std::vector<char> block_unzip (const std::string & zipped_name,
+                               const std::size_t begin,
+                               const std::size_t end);
+
+
 /**
  * This Functor simply takes an object and reverses its byte
  * representation.  This is useful for changing endian-ness
@@ -54,6 +54,9 @@ const unsigned int xdr_MAX_STRING_LENGTH=256;
 namespace libMesh
 {
 
+// Forward declarations
+class AsciiTokenizer;
+
 /**
  * This class implements a C++ interface to the XDR
  * (eXternal Data Representation) format.  XDR is useful for
@@ -73,6 +76,9 @@ public:
   /**
    * Constructor.  Takes the filename and the mode.
    * Valid modes are ENCODE, DECODE, READ, and WRITE.
+   *
+   * Files with names ending in ".zb" are block compressed in any
+   * mode, see Utility::block_zip_file().
    */
   Xdr (const std::string & name="", const XdrMODE m=UNKNOWN);
 
@@ -227,6 +233,11 @@ private:
    */
   std::unique_ptr<std::istream> in;
 
+  /**
+   * Parses ASCII input from \p in.
+   */
+  std::unique_ptr<AsciiTokenizer> in_tokens;
+
   /**
    * The output file stream.
    */
@@ -241,7 +252,7 @@ private:
   /**
    * Are we reading/writing zipped files?
    */
-  bool gzipped_file, bzipped_file, xzipped_file;
+  bool gzipped_file, bzipped_file, xzipped_file, block_zipped_file;
 
   /**
    * Version of the file being read
@@ -78,6 +78,7 @@ AS_ECHO(["  id size (subdomains)............. : $subdomain_bytes bytes"])
 AS_ECHO(["  infinite elements................ : $enableifem"])
 AS_ECHO(["  Dirichlet constraints............ : $enabledirichlet"])
 AS_ECHO(["  node constraints................. : $enablenodeconstraint"])
+AS_ECHO(["  padded TypeVector storage........ : $enablepaddedtypevector"])
 AS_ECHO(["  parallel mesh.................... : $enableparmesh"])
 AS_ECHO(["  performance logging.............. : $enableperflog"])
 AS_ECHO(["  periodic boundary conditions..... : $enableperiodic"])
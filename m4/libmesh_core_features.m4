@@ -130,6 +130,25 @@ AS_IF([test "$enableblockedstorage" != no],
 # --------------------------------------------------------------
 
 
+# --------------------------------------------------------------
+# padded TypeVector storage - disabled by default.
+#   Stores 3D vectors and Points with a fourth zero entry, for
+#   4-wide SIMD operations.  This changes sizeof(Point), and so the
+#   library ABI.
+# --------------------------------------------------------------
+AC_ARG_ENABLE(padded-type-vector,
+              [AS_HELP_STRING([--enable-padded-type-vector],[Pad 3D TypeVector storage to 4 entries for SIMD])],
+              enablepaddedtypevector=$enableval,
+              enablepaddedtypevector=no)
+
+AS_IF([test "$enablepaddedtypevector" != no],
+      [
+        AC_MSG_RESULT([<<< Configuring library to pad TypeVector storage >>>])
+        AC_DEFINE(ENABLE_PADDED_TYPE_VECTOR, 1, [Flag indicating if 3D TypeVector storage is padded to 4 entries])
+      ])
+# --------------------------------------------------------------
+
+
 # --------------------------------------------------------------
 # legacy include paths - disabled by default
 # --------------------------------------------------------------
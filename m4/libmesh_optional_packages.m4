@@ -258,7 +258,7 @@ AS_IF([test "$enabletrilinos" = yes],
 # Choose between TBB, OpenMP, and pthreads thread models.
 # The user can control this by configuring with
 #
-# --with-thread-model={tbb,pthread,auto,none}
+# --with-thread-model={tbb,pthread,openmp,auto,none}
 #
 # where "auto" will try to automatically detect the best possible
 # version (see threads.m4).
@@ -27,9 +27,10 @@ AC_DEFUN([ACX_BEST_THREAD],
   dnl machine with 4 physical cores will try and spawn up to 16
   dnl simultaneous threads in this configuration.
   dnl
-  dnl [0]: The "pthread" threading model (see below) can optionally use
-  dnl OpenMP pragmas for its parallel_for() and parallel_reduce()
-  dnl implementations.
+  dnl [0]: The "openmp" threading model (see below) implements
+  dnl parallel_for() and parallel_reduce() with OpenMP, and the
+  dnl "pthread" threading model can optionally use OpenMP pragmas for
+  dnl them too.
   dnl
   dnl [1]: https://gcc.gnu.org/onlinedocs/libgomp/OMP_005fNUM_005fTHREADS.html
   AC_ARG_ENABLE(openmp,
@@ -77,8 +78,19 @@ AC_DEFUN([ACX_BEST_THREAD],
   dnl Set this variable when a threading model is found
   found_thread_model=none
 
-  dnl First, try pthreads/openmp as long as the user requested it (or auto).
-  AS_IF([test "x$requested_thread_model" = "xpthread" || test "x$requested_thread_model" = "xauto" || test "x$requested_thread_model" = "xopenmp"],
+  dnl The OpenMP thread model implements libMesh::Threads with OpenMP
+  dnl itself, so that libMesh shares the application's thread team.
+  dnl We already threw an error above if OpenMP could not be used.
+  AS_IF([test "x$requested_thread_model" = "xopenmp"],
+        [
+          AC_DEFINE(USING_THREADS, 1, [Flag indicating whether the library shall be compiled to use any particular thread API.])
+          AC_DEFINE(USING_OPENMP_THREADS, 1, [Flag indicating whether the library uses OpenMP as its thread API.])
+          AC_MSG_RESULT(<<< Configuring library with OpenMP threads >>>)
+          found_thread_model=openmp
+        ])
+
+  dnl Otherwise, try pthreads as long as the user requested it (or auto).
+  AS_IF([test "x$requested_thread_model" = "xpthread" || test "x$requested_thread_model" = "xauto"],
         [
           dnl Let the user explicitly specify --{enable,disable}-pthreads.
           AC_ARG_ENABLE(pthreads,
@@ -109,12 +121,10 @@ AC_DEFUN([ACX_BEST_THREAD],
           dnl could not be configured correctly.
           AS_IF([test "x$enablepthreads" = "xno" && test "x$requested_thread_model" = "xpthread"],
                 [AC_MSG_ERROR([requested threading model, pthreads, could not be found.])])
-          AS_IF([test "x$enablepthreads" = "xno" && test "x$requested_thread_model" = "xopenmp"],
-                [AC_MSG_ERROR([openmp threading model requested, but required pthread support unavailable.])])
         ])
 
   dnl Try to configure TBB if the user explicitly requested it, or if we
-  dnl are doing auto detection and pthreads/openmp detection did not
+  dnl are doing auto detection and pthreads detection did not
   dnl succeed.
   AS_IF([test "x$found_thread_model" = "xnone"],
         [
@@ -14,6 +14,7 @@
 #include <libmesh/system.h>
 #include <libmesh/quadrature_gauss.h>
 
+#include <cstdint>
 #include <vector>
 
 #include "libmesh_cppunit.h"
@@ -24,6 +25,10 @@
   CPPUNIT_TEST( testGradUComp );                \
   CPPUNIT_TEST( testHessU );                    \
   CPPUNIT_TEST( testHessUComp );                \
+  CPPUNIT_TEST( testShapeTables );              \
+  CPPUNIT_TEST( testReferenceShapeCache );      \
+  CPPUNIT_TEST( testBatchShapes );              \
+  CPPUNIT_TEST( testBatchInverseMap );          \
   CPPUNIT_TEST( testDualDoesntScreamAndDie );
 
 using namespace libMesh;
@@ -384,6 +389,184 @@ public:
 #endif
   }
 
+  void testShapeTables()
+  {
+    // Clough-Tocher elements still don't work multithreaded
+    if (family == CLOUGH && libMesh::n_threads() > 1)
+      return;
+
+    // Handle the "more processors than elements" case
+    if (!_elem)
+      return;
+
+    const std::vector<std::vector<Real>> & phi = _fe->get_phi();
+    const std::vector<std::vector<RealGradient>> & dphi = _fe->get_dphi();
+
+    // The tables are copied on demand, so they need no prerequest
+    // and must be brought up to date after each reinit, here to a
+    // different number of points
+    std::vector<Point> master_points(1, Point(0.1, 0.1, 0.1));
+
+    for (auto pts : {static_cast<std::vector<Point> *>(nullptr), &master_points})
+      {
+        _fe->reinit(_elem, pts);
+
+        const FEShapeTable<Real> & phi_table = _fe->get_phi_table();
+        const FEShapeTable<RealGradient> & dphi_table = _fe->get_dphi_table();
+
+        CPPUNIT_ASSERT_EQUAL(phi.size(), std::size_t(phi_table.size()));
+        CPPUNIT_ASSERT_EQUAL(dphi.size(), std::size_t(dphi_table.size()));
+
+        for (auto i : index_range(phi))
+          {
+            CPPUNIT_ASSERT_EQUAL(phi[i].size(), std::size_t(phi_table[i].size()));
+
+            // Real rows should be aligned for vectorization
+            CPPUNIT_ASSERT_EQUAL
+              (std::uintptr_t(0),
+               reinterpret_cast<std::uintptr_t>(phi_table[i].data()) %
+               FEShapeTable<Real>::alignment);
+
+            for (auto qp : index_range(phi[i]))
+              {
+                CPPUNIT_ASSERT_EQUAL(phi[i][qp], phi_table[i][qp]);
+                CPPUNIT_ASSERT_EQUAL(dphi[i][qp], dphi_table[i][qp]);
+              }
+          }
+
+        if (pts)
+          CPPUNIT_ASSERT_EQUAL(1u, phi_table.n_qp());
+      }
+  }
+
+  void testReferenceShapeCache()
+  {
+    // Clough-Tocher elements still don't work multithreaded
+    if (family == CLOUGH && libMesh::n_threads() > 1)
+      return;
+
+    // Handle the "more processors than elements" case
+    if (!_elem)
+      return;
+
+    _fe->reinit(_elem);
+
+    // A second FE object may get its reference shapes from the cache
+    // filled by the first; it should see exactly the same values,
+    // even after a side reinit in between.
+    std::unique_ptr<FEBase> fe2 = FEBase::build(_dim, _fe->get_fe_type());
+    fe2->attach_quadrature_rule(_qrule);
+    const std::vector<std::vector<Real>> & phi2 = fe2->get_phi();
+    const std::vector<std::vector<RealGradient>> & dphi2 = fe2->get_dphi();
+
+    if (_dim > 1)
+      {
+        QGauss side_qrule(_dim-1, _fe->get_fe_type().default_quadrature_order());
+        fe2->attach_quadrature_rule(&side_qrule);
+        fe2->reinit(_elem, 0);
+        fe2->attach_quadrature_rule(_qrule);
+      }
+
+    fe2->reinit(_elem);
+
+    const std::vector<std::vector<Real>> & phi = _fe->get_phi();
+    const std::vector<std::vector<RealGradient>> & dphi = _fe->get_dphi();
+
+    CPPUNIT_ASSERT_EQUAL(phi.size(), phi2.size());
+    for (auto i : index_range(phi))
+      {
+        CPPUNIT_ASSERT_EQUAL(phi[i].size(), phi2[i].size());
+        for (auto qp : index_range(phi[i]))
+          {
+            LIBMESH_ASSERT_FP_EQUAL(phi[i][qp], phi2[i][qp], TOLERANCE*TOLERANCE);
+            for (unsigned int d = 0; d != LIBMESH_DIM; ++d)
+              LIBMESH_ASSERT_FP_EQUAL(dphi[i][qp](d), dphi2[i][qp](d), TOLERANCE*TOLERANCE);
+          }
+      }
+  }
+
+  void testBatchShapes()
+  {
+    // Clough-Tocher elements still don't work multithreaded
+    if (family == CLOUGH && libMesh::n_threads() > 1)
+      return;
+
+    // Handle the "more processors than elements" case
+    if (!_elem)
+      return;
+
+    const FEType fe_type = _fe->get_fe_type();
+    const unsigned int n_shapes = FEInterface::n_shape_functions(fe_type, _elem);
+
+    std::vector<Point> points(_qrule->get_points());
+    points.push_back(_elem->master_point(0));
+
+    std::vector<std::vector<Real>> phi(n_shapes, std::vector<Real>(points.size()));
+    FEInterface::all_shapes(_dim, fe_type, _elem, points, phi);
+
+    std::vector<std::vector<Real>> dphi[3];
+    std::vector<std::vector<Real>> * comps[3] = {nullptr, nullptr, nullptr};
+    for (unsigned int j = 0; j != _dim; ++j)
+      {
+        dphi[j].assign(n_shapes, std::vector<Real>(points.size()));
+        comps[j] = &dphi[j];
+      }
+    FEInterface::all_shape_derivs(_dim, fe_type, _elem, points, comps);
+
+    for (unsigned int i = 0; i != n_shapes; ++i)
+      for (auto qp : index_range(points))
+        {
+          LIBMESH_ASSERT_FP_EQUAL
+            (FEInterface::shape(fe_type, _elem, i, points[qp]),
+             phi[i][qp], TOLERANCE*TOLERANCE);
+
+          for (unsigned int j = 0; j != _dim; ++j)
+            LIBMESH_ASSERT_FP_EQUAL
+              (FEInterface::shape_deriv(fe_type, _elem, i, j, points[qp]),
+               dphi[j][i][qp], TOLERANCE*TOLERANCE);
+        }
+  }
+
+  void testBatchInverseMap()
+  {
+    // Handle the "more processors than elements" case
+    if (!_elem)
+      return;
+
+    // Map the quadrature points out and back, one at a time, a batch
+    // at a time, and element by element with the threaded driver
+    std::vector<Point> physical_points;
+    for (const Point & qp : _qrule->get_points())
+      physical_points.push_back(FEMap::map(_dim, _elem, qp));
+
+    std::vector<Point> batch_points;
+    FEMap::inverse_map(_dim, _elem, physical_points, batch_points);
+
+    std::vector<const Elem *> elems(2, _elem);
+    std::vector<std::vector<Point>> threaded_physical(2, physical_points);
+    threaded_physical[1].resize(1);
+    std::vector<std::vector<Point>> threaded_points;
+    FEMap::inverse_map(elems, threaded_physical, threaded_points);
+
+    CPPUNIT_ASSERT_EQUAL(physical_points.size(), batch_points.size());
+    CPPUNIT_ASSERT_EQUAL(std::size_t(2), threaded_points.size());
+    CPPUNIT_ASSERT_EQUAL(physical_points.size(), threaded_points[0].size());
+    CPPUNIT_ASSERT_EQUAL(std::size_t(1), threaded_points[1].size());
+
+    for (auto qp : index_range(physical_points))
+      {
+        const Point single =
+          FEMap::inverse_map(_dim, _elem, physical_points[qp]);
+
+        LIBMESH_ASSERT_FP_EQUAL(0, (single - _qrule->get_points()[qp]).norm(), TOLERANCE);
+        LIBMESH_ASSERT_FP_EQUAL(0, (single - batch_points[qp]).norm(), TOLERANCE*TOLERANCE);
+        LIBMESH_ASSERT_FP_EQUAL(0, (single - threaded_points[0][qp]).norm(), TOLERANCE*TOLERANCE);
+      }
+
+    LIBMESH_ASSERT_FP_EQUAL
+      (0, (threaded_points[1][0] - batch_points[0]).norm(), TOLERANCE*TOLERANCE);
+  }
+
   void testDualDoesntScreamAndDie()
   {
     // Clough-Tocher elements still don't work multithreaded
@@ -17,7 +17,9 @@
   CPPUNIT_TEST( testLocalizeIndices );          \
   CPPUNIT_TEST( testLocalizeIndicesBase );      \
   CPPUNIT_TEST( testLocalizeToOne );            \
-  CPPUNIT_TEST( testLocalizeToOneBase );
+  CPPUNIT_TEST( testLocalizeToOneBase );        \
+  CPPUNIT_TEST( testViews );                    \
+  CPPUNIT_TEST( testViewsBase );
 
 #ifndef LIBMESH_HAVE_CXX14_MAKE_UNIQUE
 using libMesh::make_unique;
@@ -135,6 +137,81 @@ public:
     }
   }
 
+  template <class Base, class Derived>
+  void Views()
+  {
+    unsigned int block_size  = 10;
+
+    // a different size on each processor.
+    unsigned int local_size  = block_size +
+      static_cast<unsigned int>(my_comm->rank());
+    unsigned int global_size = 0;
+
+    for (libMesh::processor_id_type p=0; p<my_comm->size(); p++)
+      global_size += (block_size + static_cast<unsigned int>(p));
+
+    {
+      auto v_ptr = libmesh_make_unique<Derived>(*my_comm, global_size, local_size);
+      Base & v = *v_ptr;
+
+      const libMesh::dof_id_type
+        first = v.first_local_index(),
+        last  = v.last_local_index();
+
+      {
+        typename Base::WriteView view(v);
+        CPPUNIT_ASSERT_EQUAL(first, view.first_local_index());
+        CPPUNIT_ASSERT_EQUAL(last, view.last_local_index());
+
+        for (libMesh::dof_id_type n=first; n != last; n++)
+          view(n) = static_cast<libMesh::Number>(n);
+
+        // Writes through the array land in the same place
+        if (first != last)
+          view.data()[0] += 1;
+      }
+      v.close();
+
+      for (libMesh::dof_id_type n=first; n != last; n++)
+        LIBMESH_ASSERT_FP_EQUAL(libMesh::libmesh_real(n + (n == first)),
+                                libMesh::libmesh_real(v(n)),
+                                libMesh::TOLERANCE*libMesh::TOLERANCE);
+
+      const Base & cv = v;
+      typename Base::ReadView view(cv);
+
+      std::vector<libMesh::dof_id_type> indices;
+      for (libMesh::dof_id_type n=first; n != last; n++)
+        {
+          CPPUNIT_ASSERT_EQUAL(n - first, view.local_index(n));
+          LIBMESH_ASSERT_FP_EQUAL(libMesh::libmesh_real(cv(n)),
+                                  libMesh::libmesh_real(view(n)),
+                                  libMesh::TOLERANCE*libMesh::TOLERANCE);
+          LIBMESH_ASSERT_FP_EQUAL(libMesh::libmesh_real(cv(n)),
+                                  libMesh::libmesh_real(view.data()[n - first]),
+                                  libMesh::TOLERANCE*libMesh::TOLERANCE);
+          indices.push_back(last - 1 - (n - first));
+        }
+
+      std::vector<libMesh::Number> values(indices.size());
+      view.get(indices, values.data());
+      for (auto i : libMesh::index_range(indices))
+        LIBMESH_ASSERT_FP_EQUAL(libMesh::libmesh_real(cv(indices[i])),
+                                libMesh::libmesh_real(values[i]),
+                                libMesh::TOLERANCE*libMesh::TOLERANCE);
+    }
+  }
+
+  void testViews()
+  {
+    Views<DerivedClass,DerivedClass>();
+  }
+
+  void testViewsBase()
+  {
+    Views<libMesh::NumericVector<libMesh::Number>,DerivedClass>();
+  }
+
   void testLocalize()
   {
     Localize<DerivedClass,DerivedClass>();
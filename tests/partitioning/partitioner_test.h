@@ -3,6 +3,8 @@
 
 #include <libmesh/distributed_mesh.h>
 #include <libmesh/elem.h>
+#include <libmesh/error_vector.h>
+#include <libmesh/int_range.h>
 #include <libmesh/partitioner.h>
 #include <libmesh/replicated_mesh.h>
 #include <libmesh/mesh_generation.h>
@@ -16,7 +18,8 @@
   CPPUNIT_TEST( testPartitionEmpty );           \
   CPPUNIT_TEST( testPartition1 );               \
   CPPUNIT_TEST( testPartition2 );               \
-  CPPUNIT_TEST( testPartitionNProc );
+  CPPUNIT_TEST( testPartitionNProc );           \
+  CPPUNIT_TEST( testRepartition );
 #else
 #define PARTITIONERTEST
 #endif
@@ -91,6 +94,46 @@ public:
     newpart.partition(mesh, TestCommWorld->size());
   }
 
+  void testRepartition()
+  {
+    MeshClass mesh(*TestCommWorld);
+
+    MeshTools::Generation::build_cube (mesh,
+                                       3, 3, 3,
+                                       0., 1., 0., 1., 0., 1.,
+                                       HEX8);
+
+    // Predict that the first element gets refined
+    ErrorVector error_per_cell(mesh.max_elem_id(), 0.), weights;
+    error_per_cell[0] = 1;
+    Partitioner::predictive_weights(mesh, error_per_cell, 0.5, weights);
+
+    CPPUNIT_ASSERT_EQUAL(weights.size(), std::size_t(mesh.max_elem_id()));
+    CPPUNIT_ASSERT_EQUAL(weights[0], ErrorVectorReal(8*8));
+    for (auto i : make_range(dof_id_type(1), mesh.max_elem_id()))
+      CPPUNIT_ASSERT_EQUAL(weights[i], ErrorVectorReal(8));
+
+    std::vector<std::pair<dof_id_type, processor_id_type>> old_owners;
+    for (const auto & elem : mesh.active_local_element_ptr_range())
+      old_owners.emplace_back(elem->id(), elem->processor_id());
+
+    PartitionerSubclass newpart;
+    newpart.repartition(mesh, TestCommWorld->size());
+
+    // Count the elements which moved ourselves
+    dof_id_type n_migrated = 0;
+    for (const auto & pr : old_owners)
+      {
+        const Elem * elem = mesh.query_elem_ptr(pr.first);
+        if (!elem || elem->processor_id() != pr.second)
+          ++n_migrated;
+      }
+    TestCommWorld->sum(n_migrated);
+
+    CPPUNIT_ASSERT_EQUAL(newpart.n_migrated_elem(), n_migrated);
+    CPPUNIT_ASSERT(newpart.n_migrated_elem() <= mesh.n_active_elem());
+  }
+
   void testPartition1()
   {
     this->testPartition(1);
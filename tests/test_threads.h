@@ -0,0 +1,60 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+#ifndef TEST_THREADS_H
+#define TEST_THREADS_H
+
+#include <libmesh/libmesh.h>
+
+#ifdef LIBMESH_HAVE_OPENMP
+#include <omp.h>
+#endif
+
+// Sets the number of threads used by Threads::parallel_for() and
+// parallel_reduce() for the lifetime of this object, so a test can
+// exercise threaded code paths whatever --n_threads the test driver
+// was given.  Without a threading model the work still runs
+// serially, but code which chooses its algorithm by
+// libMesh::n_threads() takes its threaded branch.
+class ScopedNThreads
+{
+public:
+  explicit ScopedNThreads (int n_threads) :
+    _old_n_threads(libMesh::libMeshPrivateData::_n_threads)
+  {
+    set(n_threads);
+  }
+
+  ~ScopedNThreads ()
+  {
+    set(_old_n_threads);
+  }
+
+private:
+  static void set (int n_threads)
+  {
+    libMesh::libMeshPrivateData::_n_threads = n_threads;
+#ifdef LIBMESH_HAVE_OPENMP
+    omp_set_num_threads(n_threads);
+#endif
+  }
+
+  const int _old_n_threads;
+};
+
+#endif // TEST_THREADS_H